@@ -18,6 +18,9 @@
 #include "ssd1306_i2c.h"
 #include "ssd1306.h"
 #include "display.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 /**
  * @brief Exibe uma mensagem na tela OLED por 2 segundos e em seguida limpa a tela.
@@ -50,3 +53,317 @@ void exibir_e_esperar(const char *mensagem, int linha_y) {
     oled_clear(buffer_oled, &area);
     render_on_display(buffer_oled, &area);
 }
+
+/**
+ * @brief Compara o tempo de CPU por quadro entre o envio bloqueante e o envio por DMA.
+ *
+ * @param quadros  Número de quadros completos (1024 bytes) enviados em cada modo.
+ *
+ * Cada quadro é forçado a ser enviado por inteiro (`ssd1306_mark_all_dirty()`), e o tempo
+ * de CPU é lido de `ssd1306_get_stats()`. No modo DMA, o tempo de transmissão em si não é
+ * contado: a função aguarda o fim de cada quadro apenas para medir o próximo isoladamente.
+ */
+void benchmark_envio_oled(int quadros) {
+    uint64_t cpu_bloqueante_us = 0;
+    uint64_t cpu_dma_us = 0;
+
+    ssd1306_async_set_enabled(false);
+    for (int i = 0; i < quadros; i++) {
+        ssd1306_mark_all_dirty();
+        render_on_display(buffer_oled, &area);
+        cpu_bloqueante_us += ssd1306_get_stats()->last_frame_cpu_us;
+    }
+
+    ssd1306_async_set_enabled(true);
+    for (int i = 0; i < quadros; i++) {
+        ssd1306_mark_all_dirty();
+        render_on_display(buffer_oled, &area);
+        cpu_dma_us += ssd1306_get_stats()->last_frame_cpu_us;
+        ssd1306_async_wait();
+    }
+
+    printf("[OLED] CPU por quadro: bloqueante %llu us | DMA %llu us (%d quadros)\n",
+           (unsigned long long)(cpu_bloqueante_us / quadros),
+           (unsigned long long)(cpu_dma_us / quadros), quadros);
+}
+
+/**
+ * @brief Mede o custo de `ssd1306_blit()` e o tráfego I²C do modo bitmap (`ssd1306_t`).
+ *
+ * @param repeticoes  Número de cópias de sprite cronometradas em cada caso.
+ *
+ * Um sprite de teste de 16x32 pixels (mesmo tamanho dos dígitos grandes) é copiado com y
+ * alinhado à página (caminho rápido) e desalinhado (deslocamento entre duas páginas).
+ * Em seguida, a tela é composta e enviada uma única vez, e os bytes contados são
+ * comparados com o custo do `ssd1306_draw_bitmap()` antigo, que enviava o quadro
+ * inteiro a cada byte copiado.
+ *
+ * O modo bitmap usa endereçamento vertical; ao final o display é reinicializado para o
+ * modo horizontal usado por `render_on_display()`.
+ *
+ * Também roda no PC, com os dígitos grandes do TrendWatch: `host/teste_oled_host.c`.
+ */
+void benchmark_blit_oled(int repeticoes) {
+    static uint8_t dados[16 * 4];
+    for (int p = 0; p < 4; p++) {
+        for (int c = 0; c < 16; c++) {
+            dados[p * 16 + c] = (c == 0 || c == 15) ? 0xFF : (uint8_t)(0x81 | (1u << (c % 8)));
+        }
+    }
+    const ssd1306_sprite_t sprite = { .width = 16, .height = 32, .data = dados };
+
+    ssd1306_async_wait();
+
+    ssd1306_t tela;
+    ssd1306_init_bm(&tela, ssd1306_width, ssd1306_height, false, ssd1306_i2c_address, i2c1);
+    ssd1306_config(&tela);
+
+    uint64_t inicio = time_us_64();
+    for (int i = 0; i < repeticoes; i++) {
+        ssd1306_blit(&tela, &sprite, (i * 16) % 112, 16, SSD1306_BLIT_XOR);
+    }
+    uint64_t alinhado_us = time_us_64() - inicio;
+
+    inicio = time_us_64();
+    for (int i = 0; i < repeticoes; i++) {
+        ssd1306_blit(&tela, &sprite, (i * 16) % 112, 13, SSD1306_BLIT_XOR);
+    }
+    uint64_t desalinhado_us = time_us_64() - inicio;
+
+    // Compõe uma linha de sprites e envia o quadro uma única vez
+    memset(tela.ram_buffer + 1, 0, tela.bufsize - 1);
+    for (int x = 0; x < ssd1306_width; x += 16) {
+        ssd1306_blit(&tela, &sprite, x, 13, SSD1306_BLIT_OR);
+    }
+    uint32_t bytes_antes = tela.bytes_sent;
+    ssd1306_send_data(&tela);
+    uint32_t bytes_quadro = tela.bytes_sent - bytes_antes;
+
+    // Custo do draw_bitmap antigo: um envio completo (6 comandos + quadro) por byte copiado
+    uint32_t bytes_antigo = (tela.bufsize - 1) * (6 * 2 + tela.bufsize);
+
+    printf("[OLED] Blit 16x32: alinhado %.2f us | desalinhado %.2f us\n",
+           (double)alinhado_us / repeticoes, (double)desalinhado_us / repeticoes);
+    printf("[OLED] Bytes por quadro bitmap: %lu (antes: %lu)\n",
+           (unsigned long)bytes_quadro, (unsigned long)bytes_antigo);
+
+    free(tela.ram_buffer);
+
+    // Volta ao endereçamento horizontal do modo render_area
+    ssd1306_init();
+}
+
+// Busca do glifo anterior à tabela font_index[]: uma comparação por faixa ou caractere.
+// Mantida só como referência "antes" em benchmark_texto_oled().
+static uint8_t indice_glifo_antigo(uint8_t character) {
+    if (character >= 'A' && character <= 'Z') return character - 'A' + 1;
+    if (character >= '0' && character <= '9') return character - '0' + 27;
+    if (character >= 'a' && character <= 'z') return character - 'a' + 37;
+    if (character == '.') return 63;
+    if (character == ':') return 64;
+    if (character == 0x23) return 65;  // #
+    if (character == 0x21) return 66;  // !
+    if (character == 0x3F) return 67;  // ?
+    if (character == 0xC3) return 68;  // Ã
+    if (character == 0xC2) return 69;  // Â
+    if (character == 0xC1) return 70;  // Á
+    if (character == 0xC0) return 71;  // À
+    if (character == 0xC9) return 72;  // É
+    if (character == 0xCA) return 73;  // Ê
+    if (character == 0xCD) return 74;  // Í
+    if (character == 0xD3) return 75;  // Ó
+    if (character == 0xD4) return 76;  // Ô
+    if (character == 0xD5) return 77;  // Õ
+    if (character == 0xDA) return 78;  // Ú
+    if (character == 0xC7) return 79;  // Ç
+    if (character == 0xE7) return 80;  // ç
+    if (character == 0xE3) return 81;  // ã
+    if (character == 0xE1) return 82;  // á
+    if (character == 0xE0) return 83;  // à
+    if (character == 0xE2) return 84;  // â
+    if (character == 0xE9) return 85;  // é
+    if (character == 0xEA) return 86;  // ê
+    if (character == 0xED) return 87;  // í
+    if (character == 0xF3) return 88;  // ó
+    if (character == 0xF4) return 89;  // ô
+    if (character == 0xFA) return 90;  // ú
+    if (character == 0x2C) return 91;  // ,
+    if (character == '-')  return 92;  // -
+
+    return 0; // caractere vazio/inválido
+}
+
+// Decodificação UTF-8 → Latin-1 de ssd1306_draw_utf8_multiline() com a busca antiga
+static int texto_prepare_antigo(ssd1306_text_t *text, const char *utf8_string) {
+    text->length = 0;
+    while (*utf8_string && text->length < SSD1306_TEXT_MAX) {
+        uint8_t c = (uint8_t)*utf8_string++;
+        if ((c & 0xE0) == 0xC0) {
+            c = (uint8_t)(((c & 0x1F) << 6) | ((uint8_t)*utf8_string++ & 0x3F));
+        } else if (c & 0x80) {
+            c = 0;   // UTF-8 > 2 bytes: ignora um byte, como o código antigo
+        }
+        text->glyphs[text->length++] = indice_glifo_antigo(c);
+    }
+    return text->length;
+}
+
+/**
+ * @brief Mede a vazão de texto (glifos por segundo) com as mensagens de status do projeto.
+ *
+ * @param repeticoes  Número de vezes que o conjunto de mensagens é desenhado em cada caso.
+ *
+ * Compara quatro caminhos sobre o mesmo conjunto de strings UTF-8:
+ * - antes: decodificação a cada chamada com a cadeia de comparações antiga (`indice_glifo_antigo()`);
+ * - `ssd1306_draw_utf8_multiline()`, que decodifica a cada chamada com a tabela `font_index[]`;
+ * - `ssd1306_draw_text_multiline()` com textos pré-decodificados e y alinhado à página;
+ * - o mesmo texto pré-decodificado com y desalinhado (mescla entre duas páginas).
+ *
+ * Os dois primeiros diferem só na busca do glifo. Os índices das duas buscas são conferidos
+ * antes da medição. No PC, roda em OLED_/host/teste_oled_host.c.
+ */
+void benchmark_texto_oled(int repeticoes) {
+    static const char *mensagens[] = {
+        "ACK do PING OK",
+        "ACK do PING FALHOU",
+        "Status do Wi-Fi : CONECTADO",
+        "Intervalo: 5000 ms",
+        "RGB: VERMELHO",
+        "Núcleo 0",
+        "Status inválido.",
+    };
+    const int n = count_of(mensagens);
+    static ssd1306_text_t textos[count_of(mensagens)];
+
+    uint32_t glifos = 0;
+    for (int m = 0; m < n; m++) {
+        ssd1306_text_t antigo;
+        glifos += ssd1306_text_prepare(&textos[m], mensagens[m]);
+        texto_prepare_antigo(&antigo, mensagens[m]);
+        if (antigo.length != textos[m].length ||
+            memcmp(antigo.glyphs, textos[m].glyphs, antigo.length) != 0) {
+            printf("[OLED] Busca antiga diverge de font_index[] em \"%s\"\n", mensagens[m]);
+        }
+    }
+    glifos *= repeticoes;
+
+    // Antes: decodifica a cada quadro e busca cada glifo na cadeia de comparações
+    uint64_t inicio = time_us_64();
+    for (int i = 0; i < repeticoes; i++) {
+        for (int m = 0; m < n; m++) {
+            ssd1306_text_t text;
+            texto_prepare_antigo(&text, mensagens[m]);
+            ssd1306_draw_text_multiline(buffer_oled, 0, 0, &text);
+        }
+    }
+    uint64_t antigo_us = time_us_64() - inicio;
+
+    inicio = time_us_64();
+    for (int i = 0; i < repeticoes; i++) {
+        for (int m = 0; m < n; m++) {
+            ssd1306_draw_utf8_multiline(buffer_oled, 0, 0, mensagens[m]);
+        }
+    }
+    uint64_t utf8_us = time_us_64() - inicio;
+
+    inicio = time_us_64();
+    for (int i = 0; i < repeticoes; i++) {
+        for (int m = 0; m < n; m++) {
+            ssd1306_draw_text_multiline(buffer_oled, 0, 0, &textos[m]);
+        }
+    }
+    uint64_t alinhado_us = time_us_64() - inicio;
+
+    inicio = time_us_64();
+    for (int i = 0; i < repeticoes; i++) {
+        for (int m = 0; m < n; m++) {
+            ssd1306_draw_text_multiline(buffer_oled, 0, 3, &textos[m]);
+        }
+    }
+    uint64_t desalinhado_us = time_us_64() - inicio;
+
+    printf("[OLED] Glifos/s: UTF-8 antes %lu | UTF-8 %lu | pré-decodificado %lu | y desalinhado %lu (%lu glifos)\n",
+           (unsigned long)(glifos * 1000000ull / (antigo_us ? antigo_us : 1)),
+           (unsigned long)(glifos * 1000000ull / (utf8_us ? utf8_us : 1)),
+           (unsigned long)(glifos * 1000000ull / (alinhado_us ? alinhado_us : 1)),
+           (unsigned long)(glifos * 1000000ull / (desalinhado_us ? desalinhado_us : 1)),
+           (unsigned long)glifos);
+
+    oled_clear(buffer_oled, &area);
+    render_on_display(buffer_oled, &area);
+}
+
+#if SSD1306_EMU
+// Telas de referência para o teste de regressão com o emulador do SSD1306.
+// Os hashes são reproduzidos no PC por OLED_/host/teste_oled_host.c (-DSSD1306_EMU=1).
+typedef struct {
+    const char *texto;
+    int linha_y;
+    uint32_t hash;   // Hash da imagem esperada (ssd1306_emu_hash)
+} tela_referencia_t;
+
+static const tela_referencia_t telas_referencia[] = {
+    { "ACK do PING OK", 0, 0x94913b15u },
+    { "Status do Wi-Fi : CONECTADO", 16, 0xeb416fd1u },
+    { "Núcleo 0", 3, 0xa1f78c4fu },
+};
+
+/**
+ * @brief Teste de regressão do caminho de renderização usando o emulador do SSD1306.
+ *
+ * Para cada tela de referência, desenha o texto, envia pelo caminho bloqueante, pelo DMA e
+ * pelo quadro inteiro de `ssd1306_send_buffer()`, e confere:
+ * - se a GDDRAM emulada é idêntica a `buffer_oled` (nenhuma janela suja foi perdida);
+ * - se o hash da imagem visível coincide com o quadro de referência.
+ *
+ * Também imprime transações e bytes I²C por quadro, para acompanhar o custo de cada envio.
+ * Com `imprimir_pbm`, a imagem de cada tela sai no terminal em formato PBM.
+ *
+ * @return Número de telas com divergência (0 = todas corretas).
+ */
+int teste_emulador_oled(bool imprimir_pbm) {
+    static const char *const modos[] = { "bloqueante", "DMA", "send_buffer" };
+    int falhas = 0;
+
+    for (int modo = 0; modo < count_of(modos); modo++) {
+        ssd1306_async_set_enabled(modo == 1);
+
+        for (int i = 0; i < count_of(telas_referencia); i++) {
+            const tela_referencia_t *tela = &telas_referencia[i];
+
+            oled_clear(buffer_oled, &area);
+            ssd1306_emu_frame();
+            ssd1306_draw_utf8_multiline(buffer_oled, 0, tela->linha_y, tela->texto);
+            if (modo == 2) {
+                uint8_t janela[SSD1306_WINDOW_COMMANDS];
+                ssd1306_window_commands(janela, 0, ssd1306_width - 1, 0, ssd1306_n_pages - 1);
+                ssd1306_send_command_list(janela, SSD1306_WINDOW_COMMANDS);
+                ssd1306_send_buffer(buffer_oled, ssd1306_buffer_length);
+            } else {
+                render_on_display(buffer_oled, &area);
+            }
+            ssd1306_async_wait();
+
+            ssd1306_emu_counters_t quadro = ssd1306_emu_frame();
+            int diferentes = ssd1306_emu_compare(buffer_oled);
+            uint32_t hash = ssd1306_emu_hash();
+            bool ok = diferentes == 0 && hash == tela->hash;
+
+            printf("[EMU] %s \"%s\": %lu transações, %lu bytes | hash 0x%08lx %s\n",
+                   modos[modo], tela->texto,
+                   (unsigned long)quadro.transactions, (unsigned long)quadro.bytes,
+                   (unsigned long)hash, ok ? "OK" : "FALHOU");
+            if (imprimir_pbm && modo == 0) {
+                ssd1306_emu_dump_pbm(tela->texto);
+            }
+            if (!ok) {
+                falhas++;
+            }
+        }
+    }
+
+    ssd1306_async_set_enabled(true);
+    oled_clear(buffer_oled, &area);
+    return falhas;
+}
+#endif
@@ -13,6 +13,12 @@
  *  - `mensagem`: texto a ser exibido na tela.
  *  - `linha_y`: linha vertical (em pixels ou unidade de página) onde a mensagem será posicionada.
  *
+ * Também declara `benchmark_envio_oled()`, que compara o tempo de CPU por quadro
+ * entre o envio bloqueante e o envio assíncrono por DMA, e `benchmark_blit_oled()`, que mede
+ * o tempo de cópia de sprites e os bytes enviados no modo bitmap (`ssd1306_t`).
+ * `benchmark_texto_oled()` mede glifos por segundo com as mensagens de status do projeto.
+ * Com `SSD1306_EMU`, `teste_emulador_oled()` confere telas de referência no emulador do controlador.
+ *
  * Ideal para aplicações que exigem feedback visual ao usuário durante processos como inicialização,
  * conexão à rede, ou exibição de dados sensoriais.
  */
@@ -20,6 +26,15 @@
 #ifndef DISPLAY_H
 #define DISPLAY_H
 
+#include <stdbool.h>
+#include "ssd1306_emu.h"
+
 void exibir_e_esperar(const char *mensagem, int linha_y);
+void benchmark_envio_oled(int quadros);
+void benchmark_blit_oled(int repeticoes);
+void benchmark_texto_oled(int repeticoes);
+#if SSD1306_EMU
+int teste_emulador_oled(bool imprimir_pbm);
+#endif
 
 #endif
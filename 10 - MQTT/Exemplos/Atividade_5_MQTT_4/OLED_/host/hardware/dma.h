@@ -0,0 +1,35 @@
+/**
+ * @file hardware/dma.h (host)
+ * @brief DMA substituto: a transferência termina no mesmo instante em que é disparada.
+ *
+ * `ssd1306_render_async()` já entrega cada quadro codificado ao emulador antes de disparar
+ * o canal, então basta que o canal nunca fique ocupado.
+ */
+
+#ifndef HOST_HARDWARE_DMA_H
+#define HOST_HARDWARE_DMA_H
+
+#include "pico/stdlib.h"
+
+typedef struct { int unused; } dma_channel_config;
+enum dma_channel_transfer_size { DMA_SIZE_8, DMA_SIZE_16, DMA_SIZE_32 };
+
+static inline int dma_claim_unused_channel(bool required) { (void)required; return 0; }
+static inline dma_channel_config dma_channel_get_default_config(uint ch) { (void)ch; return (dma_channel_config){0}; }
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size s) { (void)c; (void)s; }
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool v) { (void)c; (void)v; }
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool v) { (void)c; (void)v; }
+static inline void channel_config_set_dreq(dma_channel_config *c, uint dreq) { (void)c; (void)dreq; }
+static inline void dma_channel_configure(uint ch, const dma_channel_config *c, volatile void *write_addr,
+                                         const volatile void *read_addr, uint count, bool trigger) {
+    (void)ch; (void)c; (void)write_addr; (void)read_addr; (void)count; (void)trigger;
+}
+static inline void dma_channel_transfer_from_buffer_now(uint ch, const volatile void *read_addr, uint32_t count) {
+    (void)ch; (void)read_addr; (void)count;
+}
+static inline bool dma_channel_is_busy(uint ch) { (void)ch; return false; }
+static inline void dma_channel_set_irq1_enabled(uint ch, bool enabled) { (void)ch; (void)enabled; }
+static inline bool dma_channel_get_irq1_status(uint ch) { (void)ch; return false; }
+static inline void dma_channel_acknowledge_irq1(uint ch) { (void)ch; }
+
+#endif
@@ -0,0 +1,42 @@
+/**
+ * @file hardware/i2c.h (host)
+ * @brief I²C substituto: `i2c_write_blocking()` só conta as transações e os bytes.
+ *
+ * Escritas diretas em IC_DATA_CMD são descartadas: a FIFO está sempre vazia e o STOP já detectado.
+ *
+ * O conteúdo das transações é interpretado pelo emulador do SSD1306 (`ssd1306_emu.c`),
+ * alimentado pelo próprio `ssd1306_i2c.c` quando compilado com `SSD1306_EMU=1`.
+ */
+
+#ifndef HOST_HARDWARE_I2C_H
+#define HOST_HARDWARE_I2C_H
+
+#include "pico/stdlib.h"
+
+#define I2C_IC_DATA_CMD_STOP_BITS 0x200u
+#define I2C_IC_STATUS_TFE_BITS 0x04u
+#define I2C_IC_STATUS_MST_ACTIVITY_BITS 0x20u
+#define I2C_IC_RAW_INTR_STAT_STOP_DET_BITS 0x200u
+
+typedef struct {
+    uint32_t enable, tar, status, raw_intr_stat, clr_stop_det, clr_tx_abrt, data_cmd;
+} i2c_hw_t;
+
+typedef struct {
+    i2c_hw_t hw;               // FIFO sempre vazia (status = TFE, raw_intr_stat = STOP_DET)
+    uint32_t transacoes;
+    uint32_t bytes;
+} i2c_inst_t;
+
+extern i2c_inst_t host_i2c0, host_i2c1;
+#define i2c0 (&host_i2c0)
+#define i2c1 (&host_i2c1)
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+
+static inline i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c) { return &i2c->hw; }
+static inline size_t i2c_get_write_available(i2c_inst_t *i2c) { (void)i2c; return 16; }
+static inline uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx) { (void)i2c; (void)is_tx; return 0; }
+
+#endif
@@ -0,0 +1,14 @@
+// Host: sem interrupções; o fim dos quadros assíncronos é tratado por polling
+#ifndef HOST_HARDWARE_IRQ_H
+#define HOST_HARDWARE_IRQ_H
+
+#include "pico/stdlib.h"
+
+#define DMA_IRQ_1 11
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+
+typedef void (*irq_handler_t)(void);
+static inline void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order) { (void)num; (void)handler; (void)order; }
+static inline void irq_set_enabled(uint num, bool enabled) { (void)num; (void)enabled; }
+
+#endif
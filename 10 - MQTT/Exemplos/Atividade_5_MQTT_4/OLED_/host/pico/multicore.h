@@ -0,0 +1,2 @@
+// Host: cabeçalho vazio, o driver do OLED não usa nada de pico/multicore.h
+#include "pico/stdlib.h"
@@ -0,0 +1,2 @@
+// Host: cabeçalho vazio, o driver do OLED não usa nada de pico/mutex.h
+#include "pico/stdlib.h"
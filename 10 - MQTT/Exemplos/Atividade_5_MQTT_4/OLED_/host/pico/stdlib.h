@@ -0,0 +1,39 @@
+/**
+ * @file pico/stdlib.h (host)
+ * @brief Substituto mínimo do Pico SDK para compilar o driver do OLED no PC.
+ *
+ * Só o que `ssd1306_i2c.c`, `oled_utils.c`, `display.c` e `ssd1306_emu.c` usam. As funções
+ * ficam em `pico_host.c`; o tempo vem do relógio monotônico do PC.
+ */
+
+#ifndef HOST_PICO_STDLIB_H
+#define HOST_PICO_STDLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+typedef unsigned int uint;
+
+#define _u(x) x##u
+
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+#ifndef MIN
+#define MIN(a, b) ((b) < (a) ? (b) : (a))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) < (b) ? (b) : (a))
+#endif
+
+uint64_t time_us_64(void);
+void sleep_ms(uint32_t ms);   // No PC não espera: os testes rodam sem atrasos
+
+static inline void tight_loop_contents(void) {}
+
+#define GPIO_FUNC_I2C 3
+static inline void gpio_set_function(uint gpio, int fn) { (void)gpio; (void)fn; }
+static inline void gpio_pull_up(uint gpio) { (void)gpio; }
+
+#endif
@@ -0,0 +1,34 @@
+/**
+ * @file pico_host.c
+ * @brief Implementação das funções do Pico SDK substituídas no build de PC (ver `pico/stdlib.h`).
+ */
+
+#include <time.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+#define HOST_I2C_HW { .status = I2C_IC_STATUS_TFE_BITS, .raw_intr_stat = I2C_IC_RAW_INTR_STAT_STOP_DET_BITS }
+i2c_inst_t host_i2c0 = { .hw = HOST_I2C_HW };
+i2c_inst_t host_i2c1 = { .hw = HOST_I2C_HW };
+
+uint64_t time_us_64(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+void sleep_ms(uint32_t ms) {
+    (void)ms;
+}
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) {
+    (void)i2c;
+    return baudrate;
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    (void)addr; (void)src; (void)nostop;
+    i2c->transacoes++;
+    i2c->bytes += len;
+    return (int)len;
+}
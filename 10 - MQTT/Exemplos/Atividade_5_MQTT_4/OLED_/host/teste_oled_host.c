@@ -0,0 +1,115 @@
+/**
+ * @file teste_oled_host.c
+ * @brief Build de PC do driver do OLED: benchmark de `ssd1306_blit()` com os dígitos grandes
+ *        e, com o emulador do SSD1306, teste das telas de referência.
+ *
+ * Compila `ssd1306_i2c.c`, `oled_utils.c` e `display.c` sem alterações, sobre os substitutos
+ * do Pico SDK desta pasta (`pico/`, `hardware/`, `pico_host.c`). O I²C só conta transações
+ * e bytes; o DMA termina no instante em que é disparado.
+ *
+ * Mede, para cada dígito 16x32 de `inc/font_big_logo_data.c` (TrendWatch), o tempo de cópia
+ * com y alinhado à página (caminho rápido) e desalinhado (mescla entre duas páginas), e os
+ * bytes I²C de uma tela composta com um único envio, comparados com o `ssd1306_draw_bitmap()`
+ * antigo, que enviava o quadro inteiro a cada byte copiado. `benchmark_texto_oled()` mede os
+ * glifos/s das mensagens de status com a busca de glifo antiga e com a tabela `font_index[]`.
+ *
+ * Compilado com `-DSSD1306_EMU=1`, cada transação também alimenta o emulador do controlador
+ * (`ssd1306_emu.c`) e `teste_emulador_oled()` confere as telas de referência de `display.c`
+ * pelo envio bloqueante, pelo DMA e por `ssd1306_send_buffer()`: GDDRAM igual a `buffer_oled` e hash da imagem igual ao
+ * quadro de referência. O código de saída é o número de telas com divergência; com `pbm`,
+ * as imagens saem no terminal em formato PBM.
+ *
+ * Uso (a partir de OLED_/):
+ *     gcc -O2 -std=gnu11 -Wall -DSSD1306_EMU=1 -Ihost -I. -I.. \
+ *         -I"../../../../7 - Executor Ciclico/Exemplos/TrendWatch/inc" \
+ *         host/teste_oled_host.c host/pico_host.c ssd1306_i2c.c ssd1306_emu.c oled_utils.c display.c \
+ *         "../../../../7 - Executor Ciclico/Exemplos/TrendWatch/inc/font_big_logo_data.c" \
+ *         -o teste_oled_host
+ *     ./teste_oled_host [repeticoes] [pbm]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "configura_geral.h"
+#include "oled_utils.h"
+#include "ssd1306_i2c.h"
+#include "ssd1306.h"
+#include "display.h"
+#include "font_big_logo.h"
+
+// Buffers globais do OLED (no firmware ficam em estado_mqtt.c)
+uint8_t buffer_oled[ssd1306_buffer_length];
+struct render_area area;
+
+static const uint8_t *const digitos[10] = {
+    big_digit_0, big_digit_1, big_digit_2, big_digit_3, big_digit_4,
+    big_digit_5, big_digit_6, big_digit_7, big_digit_8, big_digit_9,
+};
+
+// Tempo médio (ns) de uma cópia do sprite na linha y, percorrendo as colunas da tela
+static double mede_blit(ssd1306_t *tela, const ssd1306_sprite_t *sprite, int y, int repeticoes) {
+    uint64_t inicio = time_us_64();
+    for (int i = 0; i < repeticoes; i++) {
+        ssd1306_blit(tela, sprite, (i * 16) % 112, y, SSD1306_BLIT_XOR);
+    }
+    return (time_us_64() - inicio) * 1000.0 / repeticoes;
+}
+
+static void benchmark_logos(int repeticoes) {
+    ssd1306_t tela;
+    ssd1306_init_bm(&tela, ssd1306_width, ssd1306_height, false, ssd1306_i2c_address, i2c1);
+    ssd1306_config(&tela);
+
+    double soma_alinhado = 0, soma_desalinhado = 0;
+    printf("Dígito   alinhado (y=16)   desalinhado (y=13)\n");
+    for (int d = 0; d < 10; d++) {
+        const ssd1306_sprite_t sprite = { .width = 16, .height = 32, .data = digitos[d] };
+        double alinhado = mede_blit(&tela, &sprite, 16, repeticoes);
+        double desalinhado = mede_blit(&tela, &sprite, 13, repeticoes);
+        soma_alinhado += alinhado;
+        soma_desalinhado += desalinhado;
+        printf("  %d      %8.1f ns       %8.1f ns\n", d, alinhado, desalinhado);
+    }
+    printf("  média  %8.1f ns       %8.1f ns\n\n", soma_alinhado / 10, soma_desalinhado / 10);
+
+    // Tela com oito dígitos desalinhados, enviada uma única vez
+    memset(tela.ram_buffer + 1, 0, tela.bufsize - 1);
+    for (int x = 0; x < ssd1306_width; x += 16) {
+        const ssd1306_sprite_t sprite = { .width = 16, .height = 32, .data = digitos[x / 16] };
+        ssd1306_blit(&tela, &sprite, x, 13, SSD1306_BLIT_OR);
+    }
+    uint32_t transacoes = i2c1->transacoes;
+    uint32_t bytes = i2c1->bytes;
+    ssd1306_send_data(&tela);
+
+    // Custo do draw_bitmap antigo: um envio completo (6 comandos + quadro) por byte copiado
+    uint32_t bytes_antigo = (tela.bufsize - 1) * (6 * 2 + tela.bufsize);
+    printf("Quadro com 8 dígitos: %lu transações, %lu bytes I²C (draw_bitmap antigo: %lu bytes)\n",
+           (unsigned long)(i2c1->transacoes - transacoes), (unsigned long)(i2c1->bytes - bytes),
+           (unsigned long)bytes_antigo);
+
+    free(tela.ram_buffer);
+    ssd1306_init();
+}
+
+int main(int argc, char **argv) {
+    int repeticoes = argc > 1 ? atoi(argv[1]) : 1000000;
+    bool imprimir_pbm = argc > 2 && strcmp(argv[2], "pbm") == 0;
+    int falhas = 0;
+
+    setup_oled(buffer_oled, &area, i2c1, SDA_PIN, SCL_PIN, 400, true);
+    ssd1306_async_init();
+
+#if SSD1306_EMU
+    falhas = teste_emulador_oled(imprimir_pbm);
+    printf("[EMU] %s\n\n", falhas ? "telas divergentes" : "todas as telas conferem");
+#else
+    (void)imprimir_pbm;
+#endif
+
+    benchmark_logos(repeticoes);
+    benchmark_blit_oled(repeticoes);
+    benchmark_texto_oled(repeticoes / 100);
+    return falhas;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file oled_console.c
+ * @brief Implementação do console de mensagens com rolagem pela linha inicial do SSD1306.
+ *
+ * O anel de linhas é o próprio buffer de vídeo: a linha `k` do console fica na página
+ * `(topo + k) % 8`. Ao acrescentar uma linha com a tela cheia, a página do topo (linha mais
+ * antiga) é apagada, recebe o texto novo e `topo` avança; a linha inicial do controlador
+ * passa a `topo * 8` e a página reescrita aparece embaixo.
+ *
+ * Textos longos quebram a cada 16 caracteres e '\n' inicia uma nova linha.
+ */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "ssd1306.h"
+#include "oled_console.h"
+
+static uint8_t *console_ssd = NULL;
+static struct render_area *console_area = NULL;
+static uint8_t topo = 0;     // Página exibida no topo da tela
+static uint8_t linhas = 0;   // Linhas já escritas (até OLED_CONSOLE_LINHAS)
+
+/**
+ * @brief Limpa a tela e inicia o console com a linha inicial em 0.
+ *
+ * @param ssd   Buffer de vídeo (página a página) usado por render_on_display().
+ * @param area  Área de renderização da tela inteira.
+ */
+void oled_console_init(uint8_t *ssd, struct render_area *area) {
+    console_ssd = ssd;
+    console_area = area;
+    topo = 0;
+    linhas = 0;
+
+    memset(ssd, 0, ssd1306_buffer_length);
+    ssd1306_mark_all_dirty();
+    ssd1306_set_start_line(0);
+    render_on_display(ssd, area);
+}
+
+// Escreve `n` glifos a partir de `inicio` na próxima página do anel, rolando se a tela estiver cheia
+static void console_nova_linha(const ssd1306_text_t *texto, int inicio, int n) {
+    uint8_t pagina;
+
+    if (linhas < OLED_CONSOLE_LINHAS) {
+        pagina = (topo + linhas) % OLED_CONSOLE_LINHAS;
+        linhas++;
+    } else {
+        pagina = topo;
+        topo = (topo + 1) % OLED_CONSOLE_LINHAS;
+        ssd1306_set_start_line(topo * ssd1306_page_height);
+    }
+
+    // A página inteira é reenviada: apaga o texto antigo junto
+    memset(&console_ssd[pagina * ssd1306_width], 0, ssd1306_width);
+    ssd1306_mark_dirty(0, pagina * 8, ssd1306_width - 1, pagina * 8 + 7);
+
+    ssd1306_text_t linha;
+    linha.length = n;
+    memcpy(linha.glyphs, &texto->glyphs[inicio], n);
+    ssd1306_draw_text(console_ssd, 0, pagina * 8, &linha);
+}
+
+/**
+ * @brief Acrescenta um texto UTF-8 ao console e envia as páginas novas ao display.
+ *
+ * Cada trecho separado por '\n' ocupa uma ou mais linhas (quebra a cada 16 caracteres).
+ * Não espera o envio terminar quando o DMA está habilitado.
+ */
+void oled_console_escreve(const char *texto) {
+    if (!console_ssd) {
+        return;
+    }
+
+    char trecho[SSD1306_TEXT_MAX + 1];
+    do {
+        const char *fim = strchr(texto, '\n');
+        size_t tamanho = fim ? (size_t)(fim - texto) : strlen(texto);
+        if (tamanho > SSD1306_TEXT_MAX) {
+            tamanho = SSD1306_TEXT_MAX;
+        }
+        memcpy(trecho, texto, tamanho);
+        trecho[tamanho] = '\0';
+
+        ssd1306_text_t decodificado;
+        int total = ssd1306_text_prepare(&decodificado, trecho);
+        int inicio = 0;
+        do {
+            int n = total - inicio;
+            if (n > OLED_CONSOLE_COLUNAS) {
+                n = OLED_CONSOLE_COLUNAS;
+            }
+            console_nova_linha(&decodificado, inicio, n);
+            inicio += n;
+        } while (inicio < total);
+
+        texto = fim ? fim + 1 : NULL;
+    } while (texto);
+
+    render_on_display(console_ssd, console_area);
+}
+
+/**
+ * @brief Versão formatada de oled_console_escreve() (mesma sintaxe de printf).
+ */
+void oled_console_printf(const char *formato, ...) {
+    char texto[SSD1306_TEXT_MAX + 1];
+    va_list args;
+
+    va_start(args, formato);
+    vsnprintf(texto, sizeof(texto), formato, args);
+    va_end(args);
+
+    oled_console_escreve(texto);
+}
@@ -0,0 +1,30 @@
+/**
+ * @file oled_console.h
+ * @brief Console de mensagens com rolagem por hardware no display OLED SSD1306.
+ *
+ * A tela funciona como um terminal de 8 linhas de 16 caracteres (fonte 8x8, uma página por linha).
+ * As oito páginas do buffer formam um anel: cada nova linha é escrita na página seguinte e,
+ * com a tela cheia, sobrescreve a linha mais antiga. A rolagem é feita pelo registrador de
+ * linha inicial do controlador (`ssd1306_set_start_line()`), sem deslocar o buffer.
+ *
+ * Custo por linha constante: uma página de 128 bytes e um comando de 1 byte no próximo
+ * `render_on_display()`, que com o envio por DMA habilitado não bloqueia.
+ *
+ * Enquanto o console estiver ativo, a página do topo da tela muda a cada rolagem: o desenho
+ * em coordenadas absolutas (`ssd1306_draw_utf8_string()` etc.) não corresponde mais à posição
+ * na tela. `oled_console_init()` volta a linha inicial para 0.
+ */
+
+#ifndef OLED_CONSOLE_H
+#define OLED_CONSOLE_H
+
+#include "ssd1306.h"
+
+#define OLED_CONSOLE_COLUNAS (ssd1306_width / 8)   // Caracteres por linha
+#define OLED_CONSOLE_LINHAS ssd1306_n_pages         // Linhas visíveis
+
+void oled_console_init(uint8_t *ssd, struct render_area *area);
+void oled_console_escreve(const char *texto);
+void oled_console_printf(const char *formato, ...);
+
+#endif
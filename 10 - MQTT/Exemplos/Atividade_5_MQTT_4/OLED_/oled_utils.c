@@ -23,6 +23,7 @@
 #include "ssd1306.h"
 #include <string.h>  // Para uso da função memset()
 #include "ssd1306_i2c.h"
+#include "ssd1306_emu.h"
 
 /**
  * @brief Inicializa o display OLED via I²C com os parâmetros fornecidos e define a área de renderização.
@@ -48,6 +49,11 @@ void setup_oled(uint8_t *ssd, struct render_area *area, i2c_inst_t *i2c_port, ui
     gpio_pull_up(sda);
     gpio_pull_up(scl);
 
+#if SSD1306_EMU
+    // O emulador parte do estado de reset do controlador
+    ssd1306_emu_reset();
+#endif
+
     // Inicializa o display OLED (sequência de comandos padrão SSD1306)
     ssd1306_init();
 
@@ -76,6 +82,18 @@ void setup_oled(uint8_t *ssd, struct render_area *area, i2c_inst_t *i2c_port, ui
  */
 void oled_clear(uint8_t *ssd, struct render_area *area)
 {
+    // O memset não passa pelas primitivas de desenho: marca para envio apenas
+    // as páginas que tinham algum pixel aceso (uma página já apagada não é reenviada)
+    for (uint8_t page = 0; page < ssd1306_n_pages; page++) {
+        const uint8_t *linha = ssd + page * ssd1306_width;
+        for (uint8_t x = 0; x < ssd1306_width; x++) {
+            if (linha[x]) {
+                ssd1306_mark_dirty(0, page * 8, ssd1306_width - 1, page * 8 + 7);
+                break;
+            }
+        }
+    }
+
     // Preenche o buffer com zeros (todos os pixels apagados)
     memset(ssd, 0, ssd1306_buffer_length);
 
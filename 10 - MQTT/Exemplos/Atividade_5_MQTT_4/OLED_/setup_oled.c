@@ -30,6 +30,7 @@
  * - Configurar os pinos com resistores de pull-up.
  * - Inicializar o display OLED (SSD1306).
  * - Definir a área de renderização do display.
+ * - Habilitar o envio assíncrono dos quadros via DMA.
  * - Limpar o conteúdo do display.
  * - Iniciar o processo de conexão Wi-Fi com exibição de status.
  */
@@ -48,6 +49,9 @@ void setup_init_oled(void) {
     // Inicializa o display OLED com o controlador SSD1306
     ssd1306_init();
 
+    // Habilita o envio dos quadros por DMA (render_on_display deixa de bloquear)
+    ssd1306_async_init();
+
     // Define a área de renderização para cobrir toda a tela
     area.start_column = 0;
     area.end_column = ssd1306_width - 1;
@@ -7,10 +7,16 @@
  *
  * As funções abrangem:
  * - Inicialização do display (`ssd1306_init`, `ssd1306_config`, `ssd1306_init_bm`)
- * - Controle e envio de comandos (`ssd1306_send_command`, `ssd1306_command`, `ssd1306_scroll`)
+ * - Controle e envio de comandos (`ssd1306_send_command`, `ssd1306_command`, `ssd1306_scroll`), com listas
+ *   inteiras em uma única transação I²C (`ssd1306_write_commands`, `ssd1306_command_list`, `ssd1306_window_commands`)
  * - Envio de dados gráficos (`ssd1306_send_buffer`, `ssd1306_send_data`)
  * - Manipulação gráfica de alto nível (`ssd1306_set_pixel`, `ssd1306_draw_line`, `ssd1306_draw_char`, `ssd1306_draw_string`, `ssd1306_draw_bitmap`)
  * - Renderização direta de regiões de memória (`render_on_display`, `calculate_render_area_buffer_length`)
+ * - Rastreamento de regiões modificadas (`ssd1306_mark_dirty`, `ssd1306_mark_all_dirty`, `ssd1306_get_stats`)
+ * - Rolagem vertical por hardware, aplicada no fim do próximo envio (`ssd1306_set_start_line`)
+ * - Textos pré-decodificados com posição vertical em pixels (`ssd1306_text_prepare`, `ssd1306_draw_text`, `ssd1306_draw_text_multiline`)
+ * - Cópia de sprites com recorte e modos COPY/OR/AND/XOR (`ssd1306_blit`)
+ * - Envio assíncrono por DMA (`ssd1306_async_init`, `ssd1306_render_async`, `ssd1306_async_busy`, `ssd1306_async_wait`)
  *
  * Este módulo assume o uso de um barramento I²C para comunicação com o display e depende da estrutura `ssd1306_t`
  * definida em arquivos complementares, como `ssd1306_i2c.h`.
@@ -33,7 +39,24 @@ extern void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1,
 extern void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character);
 extern void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, char *string);
 extern void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+extern void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, int number);
+extern int ssd1306_write_commands(i2c_inst_t *i2c, uint8_t address, const uint8_t *commands, int number);
+extern int ssd1306_window_commands(uint8_t *commands, uint8_t col_start, uint8_t col_end, uint8_t page_start, uint8_t page_end);
 extern void ssd1306_config(ssd1306_t *ssd);
 extern void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
 extern void ssd1306_send_data(ssd1306_t *ssd);
-extern void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap);
\ No newline at end of file
+extern void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap);
+extern void ssd1306_mark_dirty(uint8_t x_start, uint8_t y_start, uint8_t x_end, uint8_t y_end);
+extern void ssd1306_mark_all_dirty(void);
+extern void ssd1306_set_start_line(uint8_t line);
+extern const ssd1306_stats_t *ssd1306_get_stats(void);
+extern void ssd1306_async_init(void);
+extern void ssd1306_async_set_enabled(bool enabled);
+extern void ssd1306_async_set_callback(ssd1306_async_callback_t callback, void *ctx);
+extern bool ssd1306_async_busy(void);
+extern void ssd1306_async_wait(void);
+extern bool ssd1306_render_async(uint8_t *ssd, struct render_area *area);
+extern void ssd1306_blit(ssd1306_t *ssd, const ssd1306_sprite_t *sprite, int x, int y, ssd1306_blit_mode_t mode);
+extern int ssd1306_text_prepare(ssd1306_text_t *text, const char *utf8_string);
+extern void ssd1306_draw_text(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_text_t *text);
+extern void ssd1306_draw_text_multiline(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_text_t *text);
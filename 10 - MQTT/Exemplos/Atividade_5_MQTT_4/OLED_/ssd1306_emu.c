@@ -0,0 +1,253 @@
+/**
+ * @file ssd1306_emu.c
+ * @brief Interpretação do fluxo de comandos e dados do SSD1306 em uma GDDRAM de 128x64.
+ *
+ * Cada chamada a `ssd1306_emu_feed()` corresponde a uma transação I²C sem o byte de endereço.
+ * O primeiro byte é o de controle: com Co=1 apenas o byte seguinte pertence a ele e outro
+ * byte de controle vem depois; com Co=0 o restante da transação é do tipo indicado por D/C#
+ * (0 = comandos, 1 = dados). Comandos com argumentos podem continuar na transação seguinte.
+ *
+ * O emulador considera a orientação configurada por `ssd1306_init()` (remapeamento de
+ * segmentos e varredura COM invertida), ou seja, a GDDRAM é vista sem espelhamento.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306_emu.h"
+
+static ssd1306_emu_state_t st;
+static ssd1306_emu_counters_t total;
+static ssd1306_emu_counters_t last_frame;
+
+// Comando aguardando argumentos
+static uint8_t cmd_opcode;
+static uint8_t cmd_args[6];
+static uint8_t cmd_have, cmd_need;
+
+// Número de argumentos de cada comando (0 para os de um único byte)
+static uint8_t arg_count(uint8_t cmd) {
+    switch (cmd) {
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+        case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        case 0x21: case 0x22: case 0xA3:
+            return 2;
+        case 0x29: case 0x2A:
+            return 5;
+        case 0x26: case 0x27:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+static void execute_command(uint8_t cmd, const uint8_t *arg) {
+    if (cmd <= 0x0F) {                         // Página: nibble baixo da coluna
+        st.col = (st.col & 0xF0) | cmd;
+        st.col_start = st.col;
+    } else if (cmd <= 0x1F) {                  // Página: nibble alto da coluna
+        st.col = (uint8_t)(((cmd & 0x0F) << 4) | (st.col & 0x0F));
+        st.col_start = st.col;
+    } else if (cmd >= 0x40 && cmd <= 0x7F) {
+        st.start_line = cmd & 0x3F;
+    } else if (cmd >= 0xB0 && cmd <= 0xB7) {   // Página: página de escrita
+        st.page = cmd & 0x07;
+    } else {
+        switch (cmd) {
+            case 0x20: st.memory_mode = arg[0] & 0x03; break;
+            case 0x21:
+                st.col_start = arg[0] & 0x7F;
+                st.col_end = arg[1] & 0x7F;
+                st.col = st.col_start;
+                break;
+            case 0x22:
+                st.page_start = arg[0] & 0x07;
+                st.page_end = arg[1] & 0x07;
+                st.page = st.page_start;
+                break;
+            case 0x26: case 0x27:
+            case 0x29: case 0x2A:
+                st.scroll_cmd = cmd;
+                st.scroll_page_start = arg[1] & 0x07;
+                st.scroll_interval = arg[2] & 0x07;
+                st.scroll_page_end = arg[3] & 0x07;
+                st.scroll_active = false;   // A configuração desativa a rolagem em curso
+                break;
+            case 0x2E: st.scroll_active = false; break;
+            case 0x2F: st.scroll_active = true; break;
+            case 0xA4: st.entire_on = false; break;
+            case 0xA5: st.entire_on = true; break;
+            case 0xA6: st.inverse = false; break;
+            case 0xA7: st.inverse = true; break;
+            case 0xAE: st.display_on = false; break;
+            case 0xAF: st.display_on = true; break;
+            default: break;                    // Sem efeito na imagem emulada
+        }
+    }
+}
+
+static void command_byte(uint8_t b) {
+    if (cmd_need) {
+        cmd_args[cmd_have++] = b;
+        if (cmd_have == cmd_need) {
+            cmd_need = 0;
+            execute_command(cmd_opcode, cmd_args);
+        }
+        return;
+    }
+
+    cmd_opcode = b;
+    cmd_have = 0;
+    cmd_need = arg_count(b);
+    if (!cmd_need) {
+        execute_command(b, NULL);
+    }
+}
+
+// Escreve um byte na GDDRAM e avança os ponteiros conforme o modo de endereçamento
+static void data_byte(uint8_t b) {
+    st.gddram[st.page][st.col] = b;
+    total.data_bytes++;
+
+    switch (st.memory_mode) {
+        case 0:   // Horizontal: coluna, depois página
+            if (st.col >= st.col_end) {
+                st.col = st.col_start;
+                st.page = (st.page >= st.page_end) ? st.page_start : st.page + 1;
+            } else {
+                st.col++;
+            }
+            break;
+        case 1:   // Vertical: página, depois coluna
+            if (st.page >= st.page_end) {
+                st.page = st.page_start;
+                st.col = (st.col >= st.col_end) ? st.col_start : st.col + 1;
+            } else {
+                st.page++;
+            }
+            break;
+        default:  // Página: só a coluna avança, voltando ao início da linha
+            st.col = (st.col >= SSD1306_EMU_WIDTH - 1) ? st.col_start : st.col + 1;
+            break;
+    }
+}
+
+// Estado após o reset do controlador
+void ssd1306_emu_reset(void) {
+    memset(&st, 0, sizeof(st));
+    st.memory_mode = 2;
+    st.col_end = SSD1306_EMU_WIDTH - 1;
+    st.page_end = SSD1306_EMU_PAGES - 1;
+    memset(&total, 0, sizeof(total));
+    memset(&last_frame, 0, sizeof(last_frame));
+    cmd_need = 0;
+}
+
+// Interpreta uma transação I2C completa (byte de controle em diante)
+void ssd1306_emu_feed(const uint8_t *transaction, size_t len) {
+    size_t i = 0;
+
+    total.transactions++;
+    total.bytes += len;
+
+    while (i < len) {
+        uint8_t control = transaction[i++];
+        bool data = control & 0x40;
+
+        if (control & 0x80) {                  // Co=1: um único byte e outro controle
+            if (i < len) {
+                data ? data_byte(transaction[i]) : command_byte(transaction[i]);
+                i++;
+            }
+            continue;
+        }
+
+        for (; i < len; i++) {                 // Co=0: resto da transação
+            data ? data_byte(transaction[i]) : command_byte(transaction[i]);
+        }
+    }
+}
+
+// Transação de dados [0x40, data...] cujo byte de controle não está no mesmo buffer
+void ssd1306_emu_feed_data(const uint8_t *data, size_t len) {
+    total.transactions++;
+    total.bytes += len + 1;
+    for (size_t i = 0; i < len; i++) {
+        data_byte(data[i]);
+    }
+}
+
+const ssd1306_emu_state_t *ssd1306_emu_state(void) {
+    return &st;
+}
+
+ssd1306_emu_counters_t ssd1306_emu_counters(void) {
+    return total;
+}
+
+// Tráfego desde a chamada anterior (um "quadro" é o intervalo entre duas chamadas)
+ssd1306_emu_counters_t ssd1306_emu_frame(void) {
+    ssd1306_emu_counters_t frame = {
+        .transactions = total.transactions - last_frame.transactions,
+        .bytes = total.bytes - last_frame.bytes,
+        .data_bytes = total.data_bytes - last_frame.data_bytes,
+    };
+    last_frame = total;
+    return frame;
+}
+
+// Compara a GDDRAM com um buffer no formato de render_on_display() (página a página).
+// Retorna o número de bytes diferentes.
+int ssd1306_emu_compare(const uint8_t *buffer) {
+    int diferentes = 0;
+    for (int p = 0; p < SSD1306_EMU_PAGES; p++) {
+        for (int c = 0; c < SSD1306_EMU_WIDTH; c++) {
+            if (st.gddram[p][c] != buffer[p * SSD1306_EMU_WIDTH + c]) {
+                diferentes++;
+            }
+        }
+    }
+    return diferentes;
+}
+
+// Pixel visível na tela, considerando linha inicial, inversão e display desligado
+bool ssd1306_emu_pixel(int x, int y) {
+    if (!st.display_on) {
+        return false;
+    }
+    if (st.entire_on) {
+        return true;
+    }
+
+    int linha = (y + st.start_line) % (SSD1306_EMU_PAGES * 8);
+    bool aceso = (st.gddram[linha / 8][x] >> (linha % 8)) & 1;
+    return aceso != st.inverse;
+}
+
+// Hash FNV-1a da imagem visível, para comparação com quadros de referência
+uint32_t ssd1306_emu_hash(void) {
+    uint32_t hash = 2166136261u;
+    for (int y = 0; y < SSD1306_EMU_PAGES * 8; y++) {
+        for (int x = 0; x < SSD1306_EMU_WIDTH; x += 8) {
+            uint8_t byte = 0;
+            for (int b = 0; b < 8; b++) {
+                byte = (uint8_t)((byte << 1) | ssd1306_emu_pixel(x + b, y));
+            }
+            hash = (hash ^ byte) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+// Imprime a imagem visível em PBM ASCII (P1); copie do terminal para um arquivo .pbm
+void ssd1306_emu_dump_pbm(const char *nome) {
+    printf("P1\n# %s\n%d %d\n", nome ? nome : "ssd1306", SSD1306_EMU_WIDTH, SSD1306_EMU_PAGES * 8);
+    for (int y = 0; y < SSD1306_EMU_PAGES * 8; y++) {
+        char linha[SSD1306_EMU_WIDTH + 1];
+        for (int x = 0; x < SSD1306_EMU_WIDTH; x++) {
+            linha[x] = ssd1306_emu_pixel(x, y) ? '1' : '0';
+        }
+        linha[SSD1306_EMU_WIDTH] = '\0';
+        puts(linha);
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file ssd1306_emu.h
+ * @brief Emulador do controlador SSD1306 alimentado pelas mesmas transações I²C enviadas ao display.
+ *
+ * Com `SSD1306_EMU` definido como 1 (ex: `target_compile_definitions(... SSD1306_EMU=1)`), toda
+ * transação escrita por `ssd1306_i2c.c` — bloqueante ou por DMA — também é interpretada aqui:
+ *
+ * - Byte de controle (Co e D/C#), comandos com seus argumentos e escrita na GDDRAM.
+ * - Modos de endereçamento horizontal, vertical e por página, janelas de colunas/páginas.
+ * - Linha inicial, inversão, display ligado/desligado e configuração de rolagem (estado).
+ * - Contadores de transações e bytes, totais e por quadro.
+ *
+ * A imagem resultante pode ser comparada com o buffer da aplicação (`ssd1306_emu_compare()`),
+ * reduzida a um hash para comparação com quadros de referência (`ssd1306_emu_hash()`) ou
+ * impressa no terminal em formato PBM (`ssd1306_emu_dump_pbm()`).
+ *
+ * O módulo usa apenas a biblioteca C padrão, sem dependências do Pico SDK.
+ */
+
+#ifndef SSD1306_EMU_H
+#define SSD1306_EMU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifndef SSD1306_EMU
+#define SSD1306_EMU 0
+#endif
+
+#define SSD1306_EMU_WIDTH 128
+#define SSD1306_EMU_PAGES 8
+
+// Contadores de tráfego vistos pelo emulador
+typedef struct {
+    uint32_t transactions;   // Transações I2C (START ... STOP)
+    uint32_t bytes;          // Bytes após o endereço (controle + comandos + dados)
+    uint32_t data_bytes;     // Bytes escritos na GDDRAM
+} ssd1306_emu_counters_t;
+
+// Estado visível do controlador
+typedef struct {
+    uint8_t gddram[SSD1306_EMU_PAGES][SSD1306_EMU_WIDTH];
+    uint8_t memory_mode;     // 0 = horizontal, 1 = vertical, 2 = página
+    uint8_t col_start, col_end, page_start, page_end;
+    uint8_t col, page;       // Ponteiros de escrita
+    uint8_t start_line;
+    bool display_on, inverse, entire_on;
+    bool scroll_active;
+    uint8_t scroll_cmd;      // 0x26/0x27 (horizontal) ou 0x29/0x2A (vertical + horizontal)
+    uint8_t scroll_page_start, scroll_page_end, scroll_interval;
+} ssd1306_emu_state_t;
+
+void ssd1306_emu_reset(void);
+void ssd1306_emu_feed(const uint8_t *transaction, size_t len);
+void ssd1306_emu_feed_data(const uint8_t *data, size_t len);
+const ssd1306_emu_state_t *ssd1306_emu_state(void);
+ssd1306_emu_counters_t ssd1306_emu_counters(void);
+ssd1306_emu_counters_t ssd1306_emu_frame(void);
+int ssd1306_emu_compare(const uint8_t *buffer);
+bool ssd1306_emu_pixel(int x, int y);
+uint32_t ssd1306_emu_hash(void);
+void ssd1306_emu_dump_pbm(const char *nome);
+
+#endif
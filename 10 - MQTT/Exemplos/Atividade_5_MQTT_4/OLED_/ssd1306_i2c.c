@@ -11,14 +11,25 @@
  * - Escrita de comandos e dados no barramento I²C.
  * - Renderização de caracteres e strings (com suporte a acentuação comum).
  * - Desenho de linhas e bitmaps na tela.
- * - Modo buffer (via `ssd1306_t`) para exibições completas.
+ * - Modo buffer (via `ssd1306_t`) para exibições completas, com cópia de sprites
+ *   (`ssd1306_blit()`) em qualquer posição (x, y) e um único envio por quadro.
+ * - Rastreamento de páginas modificadas (dirty tracking): `render_on_display()` envia
+ *   apenas as janelas de colunas alteradas desde o último envio.
+ * - Comandos agrupados em transações únicas com byte de controle Co=0 (`ssd1306_write_commands()`),
+ *   compartilhadas pelos modos render_area e `ssd1306_t`; páginas vizinhas sujas são unidas
+ *   em uma só janela quando isso envia menos bytes.
+ * - Envio assíncrono por DMA (`ssd1306_render_async()`): o quadro é codificado em um de
+ *   dois buffers de palavras IC_DATA_CMD e transmitido pelo DMA, liberando a CPU.
+ * - Rolagem vertical pela linha inicial do controlador (`ssd1306_set_start_line()`), enviada
+ *   no fim do quadro seguinte: base do console de mensagens (`oled_console.c`).
+ * - Com `SSD1306_EMU`, cópia de cada transação para o emulador do controlador (`ssd1306_emu.c`).
  *
  * Ideal para projetos com Raspberry Pi Pico W ou similares que utilizam telas OLED I²C.
  *
  * Dependências:
  * - `ssd1306_font.h` para os bitmaps dos caracteres.
  * - `ssd1306_i2c.h` para definições de registradores e estrutura `ssd1306_t`.
- * - Pico SDK: `hardware/i2c.h`, `pico/stdlib.h`.
+ * - Pico SDK: `hardware/i2c.h`, `hardware/dma.h`, `hardware/irq.h`, `pico/stdlib.h`.
  */
 
 
@@ -29,37 +40,451 @@
 #include "pico/stdlib.h"
 #include "pico/binary_info.h"
 #include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
 #include "ssd1306_font.h"
 #include "ssd1306_i2c.h"
+#include "ssd1306_emu.h"
 
-// Calcular quanto do buffer será destinado à área de renderização
-void calculate_render_area_buffer_length(struct render_area *area) {
-    area->buffer_length = (area->end_column - area->start_column + 1) * (area->end_page - area->start_page + 1);
+// ------------------------------------------------------------
+// Rastreamento de regiões modificadas (dirty tracking)
+// ------------------------------------------------------------
+// Para cada página (8 linhas de pixels) guarda-se a faixa de colunas alterada
+// desde o último render_on_display(). Uma página limpa não é reenviada.
+static uint32_t dirty_pages = 0;                    // bit N = página N modificada
+static uint8_t dirty_start_col[ssd1306_n_pages];    // primeira coluna modificada
+static uint8_t dirty_end_col[ssd1306_n_pages];      // última coluna modificada
+
+// Contadores de tráfego I2C do display
+static ssd1306_stats_t stats = {0};
+
+// Linha inicial (comando 40h–7Fh) a enviar no fim do próximo quadro; -1 = sem alteração
+static int8_t pending_start_line = -1;
+
+// Amplia a faixa suja de uma página para incluir [col_start, col_end]
+static inline void mark_dirty_span(uint8_t page, uint8_t col_start, uint8_t col_end) {
+    if (dirty_pages & (1u << page)) {
+        if (col_start < dirty_start_col[page]) dirty_start_col[page] = col_start;
+        if (col_end > dirty_end_col[page]) dirty_end_col[page] = col_end;
+    } else {
+        dirty_pages |= 1u << page;
+        dirty_start_col[page] = col_start;
+        dirty_end_col[page] = col_end;
+    }
 }
 
-// Processo de escrita do i2c espera um byte de controle, seguido por dados
-void ssd1306_send_command(uint8_t command) {
-    uint8_t buffer[2] = {0x80, command};
-    i2c_write_blocking(i2c1, ssd1306_i2c_address, buffer, 2, false);
+// Marca como modificado o retângulo (em pixels) informado
+void ssd1306_mark_dirty(uint8_t x_start, uint8_t y_start, uint8_t x_end, uint8_t y_end) {
+    if (x_end >= ssd1306_width) x_end = ssd1306_width - 1;
+    if (y_end >= ssd1306_height) y_end = ssd1306_height - 1;
+    if (x_start > x_end || y_start > y_end) return;
+
+    for (uint8_t page = y_start / 8; page <= y_end / 8; page++) {
+        mark_dirty_span(page, x_start, x_end);
+    }
 }
 
-// Envia uma lista de comandos ao hardware
-void ssd1306_send_command_list(uint8_t *ssd, int number) {
-    for (int i = 0; i < number; i++) {
-        ssd1306_send_command(ssd[i]);
+// Marca a tela inteira como modificada (ex: após memset no buffer)
+void ssd1306_mark_all_dirty(void) {
+    ssd1306_mark_dirty(0, 0, ssd1306_width - 1, ssd1306_height - 1);
+}
+
+// Retorna os contadores de bytes enviados ao display
+const ssd1306_stats_t *ssd1306_get_stats(void) {
+    return &stats;
+}
+
+// Calcula a janela suja de uma página dentro da área e, se toda a faixa suja couber
+// na área, marca a página como limpa. Retorna false se não houver nada a enviar.
+static bool take_dirty_window(const struct render_area *area, uint8_t page, uint8_t *col_start, uint8_t *col_end) {
+    if (!(dirty_pages & (1u << page))) {
+        return false;
+    }
+
+    *col_start = MAX(dirty_start_col[page], area->start_column);
+    *col_end = MIN(dirty_end_col[page], area->end_column);
+    if (*col_start > *col_end) {
+        return false; // Alteração fora das colunas desta área
+    }
+
+    if (dirty_start_col[page] >= area->start_column && dirty_end_col[page] <= area->end_column) {
+        dirty_pages &= ~(1u << page);
     }
+    return true;
 }
 
-// Copia buffer de referência num novo buffer, a fim de adicionar o byte de controle desde o início
-void ssd1306_send_buffer(uint8_t ssd[], int buffer_length) {
-    uint8_t *temp_buffer = malloc(buffer_length + 1);
+// ------------------------------------------------------------
+// Escrita no barramento
+// ------------------------------------------------------------
+// Toda transação bloqueante passa por aqui; com SSD1306_EMU ela também alimenta o
+// emulador do controlador (ssd1306_emu.c)
+static inline void oled_write(i2c_inst_t *i2c, uint8_t address, const uint8_t *src, size_t len) {
+    i2c_write_blocking(i2c, address, src, len, false);
+#if SSD1306_EMU
+    ssd1306_emu_feed(src, len);
+#endif
+}
+
+// ------------------------------------------------------------
+// Codificação de transações de comando
+// ------------------------------------------------------------
+// O primeiro byte de cada transação I2C é o byte de controle do SSD1306. Com Co=0
+// todos os bytes seguintes têm o mesmo tipo: 0x00 = comandos, 0x40 = dados da GDDRAM.
+// Assim uma lista inteira de comandos vai em uma única transação (START, endereço,
+// 0x00, comandos..., STOP), em vez de uma transação [0x80, cmd] por byte.
+#define SSD1306_CONTROL_COMMANDS 0x00
+#define SSD1306_CONTROL_DATA 0x40
+#define SSD1306_COMMANDS_PER_TRANSACTION 32   // Listas maiores são divididas
+
+// Transação de dados [0x40, data...] escrita direto na TX FIFO, como faz i2c_write_blocking():
+// o byte de controle vai na frente sem copiar `data` para outro buffer. O RP2040 segura o
+// SCL se a FIFO esvaziar no meio; um NACK também termina em STOP, então basta esperar o STOP.
+static void oled_write_data(i2c_inst_t *i2c, uint8_t address, const uint8_t *data, size_t len) {
+    if (len == 0) {
+        return;
+    }
+    i2c_hw_t *hw = i2c_get_hw(i2c);
+    hw->enable = 0;
+    hw->tar = address;
+    hw->enable = 1;
+    (void)hw->clr_stop_det;
+    (void)hw->clr_tx_abrt;
+
+    hw->data_cmd = SSD1306_CONTROL_DATA;
+    for (size_t i = 0; i < len; i++) {
+        while (i2c_get_write_available(i2c) == 0) {
+            tight_loop_contents();
+        }
+        hw->data_cmd = data[i] | (i + 1 == len ? I2C_IC_DATA_CMD_STOP_BITS : 0);
+    }
+    while (!(hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS)) {
+        tight_loop_contents();
+    }
+    (void)hw->clr_stop_det;
+    (void)hw->clr_tx_abrt;   // Descarta um eventual NACK
+#if SSD1306_EMU
+    ssd1306_emu_feed_data(data, len);
+#endif
+}
+
+// Envia `number` comandos em uma (ou poucas) transações Co=0. Retorna os bytes escritos.
+// Usada tanto pelo modo render_area quanto pelo modo ssd1306_t.
+int ssd1306_write_commands(i2c_inst_t *i2c, uint8_t address, const uint8_t *commands, int number) {
+    uint8_t buffer[1 + SSD1306_COMMANDS_PER_TRANSACTION];
+    int bytes = 0;
+
+    buffer[0] = SSD1306_CONTROL_COMMANDS;
+    while (number > 0) {
+        int n = MIN(number, SSD1306_COMMANDS_PER_TRANSACTION);
+        memcpy(buffer + 1, commands, n);
+        oled_write(i2c, address, buffer, n + 1);
+        bytes += n + 1;
+        commands += n;
+        number -= n;
+    }
+    return bytes;
+}
+
+// Preenche os comandos que definem a janela de escrita (colunas e páginas)
+int ssd1306_window_commands(uint8_t *commands, uint8_t col_start, uint8_t col_end, uint8_t page_start, uint8_t page_end) {
+    commands[0] = ssd1306_set_column_address;
+    commands[1] = col_start;
+    commands[2] = col_end;
+    commands[3] = ssd1306_set_page_address;
+    commands[4] = page_start;
+    commands[5] = page_end;
+    return SSD1306_WINDOW_COMMANDS;
+}
+
+// Janela de envio: a mesma faixa de colunas em uma ou mais páginas consecutivas.
+// No endereçamento horizontal o controlador passa sozinho para a página seguinte ao
+// fim da faixa, então páginas vizinhas podem sair em um único burst de dados.
+typedef struct {
+    uint8_t page_start, page_end;
+    uint8_t col_start, col_end;
+} dirty_window_t;
+
+// Bytes que uma janela a mais custa: transação de comandos (controle + 6), byte de
+// controle dos dados e os bytes de endereço das duas transações
+#define SSD1306_WINDOW_COST (1 + SSD1306_WINDOW_COMMANDS + 1 + 2)
+
+// Consome as páginas sujas da área e as agrupa em janelas. Duas páginas vizinhas são
+// unidas (com a união das faixas de colunas) quando os bytes limpos reenviados custam
+// menos que abrir uma nova janela. Retorna o número de janelas.
+static int collect_windows(const struct render_area *area, dirty_window_t *windows) {
+    int count = 0;
+
+    for (uint8_t page = area->start_page; page <= area->end_page; page++) {
+        uint8_t col_start, col_end;
+        if (!take_dirty_window(area, page, &col_start, &col_end)) {
+            continue;
+        }
+
+        if (count > 0 && windows[count - 1].page_end + 1 == page) {
+            dirty_window_t *prev = &windows[count - 1];
+            uint8_t merged_start = MIN(prev->col_start, col_start);
+            uint8_t merged_end = MAX(prev->col_end, col_end);
+            int pages = prev->page_end - prev->page_start + 1;
+
+            int separate = pages * (prev->col_end - prev->col_start + 1) + (col_end - col_start + 1) + SSD1306_WINDOW_COST;
+            int merged = (pages + 1) * (merged_end - merged_start + 1);
+            if (merged <= separate) {
+                prev->page_end = page;
+                prev->col_start = merged_start;
+                prev->col_end = merged_end;
+                continue;
+            }
+        }
+
+        windows[count++] = (dirty_window_t){ page, page, col_start, col_end };
+    }
+    return count;
+}
+
+// Início, no buffer da área, da faixa de colunas da janela em uma página
+static inline const uint8_t *window_row(const uint8_t *ssd, const struct render_area *area,
+                                        const dirty_window_t *win, uint8_t page) {
+    int area_width = area->end_column - area->start_column + 1;
+    return ssd + (page - area->start_page) * area_width + (win->col_start - area->start_column);
+}
+
+// ------------------------------------------------------------
+// Envio assíncrono por DMA
+// ------------------------------------------------------------
+// O I2C do RP2040 replica escritas de 8 bits nas quatro faixas do registrador
+// IC_DATA_CMD (os bits CMD/STOP/RESTART seriam corrompidos), por isso o DMA
+// transfere palavras de 16 bits: byte de dados + bit de STOP no fim de cada transação.
+// Cada janela vira uma transação de comandos [0x00, 6 cmds] e uma de dados [0x40, pixels...].
+#define SSD1306_WINDOW_OVERHEAD (1 + SSD1306_WINDOW_COMMANDS + 1)
+#define SSD1306_STREAM_WORDS (ssd1306_n_pages * (SSD1306_WINDOW_OVERHEAD + ssd1306_width) + 2)
+
+static uint16_t dma_stream[2][SSD1306_STREAM_WORDS];   // Buffers que se alternam
+static uint16_t dma_stream_len[2];
+static volatile int8_t stream_in_flight = -1;          // Buffer em transmissão (-1 = nenhum)
+static volatile int8_t stream_pending = -1;            // Buffer pronto aguardando o anterior
+static int dma_chan = -1;
+static bool async_enabled = false;
+static ssd1306_async_callback_t async_callback = NULL;
+static void *async_callback_ctx = NULL;
+
+// Acrescenta uma transação I2C completa (byte de controle + dados, STOP no último byte)
+static uint16_t *stream_put_transaction(uint16_t *w, uint8_t control, const uint8_t *data, int len) {
+    *w++ = control;
+    for (int i = 0; i < len; i++) {
+        *w++ = data[i];
+    }
+    w[-1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    return w;
+}
+
+#if SSD1306_EMU
+// Repassa ao emulador as transações de um buffer de DMA (separadas pelo bit de STOP)
+static void emu_feed_stream(const uint16_t *words, int count) {
+    static uint8_t transaction[1 + ssd1306_buffer_length];
+    size_t len = 0;
+
+    for (int i = 0; i < count; i++) {
+        transaction[len++] = (uint8_t)words[i];
+        if (words[i] & I2C_IC_DATA_CMD_STOP_BITS) {
+            ssd1306_emu_feed(transaction, len);
+            len = 0;
+        }
+    }
+}
+#endif
+
+// Dispara a transmissão de um buffer já codificado (chamar com interrupções desabilitadas)
+static void stream_start(int8_t idx) {
+    stream_in_flight = idx;
+    dma_channel_transfer_from_buffer_now(dma_chan, dma_stream[idx], dma_stream_len[idx]);
+}
+
+// Trata o fim de uma transmissão: inicia o buffer pendente e avisa a aplicação
+static void stream_service(void) {
+    uint32_t irq_status = save_and_disable_interrupts();
+    bool terminou = stream_in_flight >= 0 && !dma_channel_is_busy(dma_chan);
+
+    if (terminou) {
+        dma_channel_acknowledge_irq1(dma_chan);
+        (void)i2c_get_hw(i2c1)->clr_tx_abrt;   // Descarta um eventual NACK do quadro anterior
+        stream_in_flight = -1;
+
+        if (stream_pending >= 0) {
+            int8_t idx = stream_pending;
+            stream_pending = -1;
+            stream_start(idx);
+        }
+    }
+    restore_interrupts(irq_status);
+
+    if (terminou && async_callback) {
+        async_callback(async_callback_ctx);
+    }
+}
+
+static void ssd1306_dma_irq_handler(void) {
+    if (dma_chan >= 0 && dma_channel_get_irq1_status(dma_chan)) {
+        stream_service();
+    }
+}
+
+// Configura o canal DMA (pacing pelo DREQ de TX do i2c1) e habilita o envio assíncrono
+void ssd1306_async_init(void) {
+    if (dma_chan >= 0) {
+        return;
+    }
+
+    dma_chan = dma_claim_unused_channel(true);
+
+    dma_channel_config cfg = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, i2c_get_dreq(i2c1, true));
+    dma_channel_configure(dma_chan, &cfg, &i2c_get_hw(i2c1)->data_cmd, NULL, 0, false);
+
+    // O endereço de destino é fixo: o stream não reprograma o IC_TAR entre quadros
+    i2c_hw_t *hw = i2c_get_hw(i2c1);
+    hw->enable = 0;
+    hw->tar = ssd1306_i2c_address;
+    hw->enable = 1;
+
+    dma_channel_set_irq1_enabled(dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_1, ssd1306_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    async_enabled = true;
+}
+
+// Indica se ainda há quadro em transmissão ou aguardando vez
+bool ssd1306_async_busy(void) {
+    if (dma_chan < 0) {
+        return false;
+    }
+
+    stream_service();   // Permite uso por polling, mesmo sem a IRQ ser atendida
+    if (stream_in_flight >= 0 || stream_pending >= 0) {
+        return true;
+    }
+
+    // O DMA terminou, mas a FIFO do I2C ainda pode estar esvaziando
+    i2c_hw_t *hw = i2c_get_hw(i2c1);
+    return !(hw->status & I2C_IC_STATUS_TFE_BITS) || (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS);
+}
+
+// Aguarda o fim de todas as transmissões assíncronas
+void ssd1306_async_wait(void) {
+    while (ssd1306_async_busy()) {
+        tight_loop_contents();
+    }
+}
+
+// Liga/desliga o desvio de render_on_display() para o envio por DMA
+void ssd1306_async_set_enabled(bool enabled) {
+    ssd1306_async_wait();
+    async_enabled = enabled && dma_chan >= 0;
+}
+
+// Registra a função chamada ao fim de cada quadro (na IRQ do DMA ou em quem fizer o polling)
+void ssd1306_async_set_callback(ssd1306_async_callback_t callback, void *ctx) {
+    async_callback = callback;
+    async_callback_ctx = ctx;
+}
+
+// Codifica as janelas sujas em um buffer livre e inicia (ou enfileira) a transmissão.
+// Retorna false, sem consumir as marcações, se os dois buffers estiverem ocupados.
+bool ssd1306_render_async(uint8_t *ssd, struct render_area *area) {
+    uint64_t inicio = time_us_64();
+
+    stream_service();
+
+    // Escolhe o buffer livre: um em transmissão e outro pendente = sem espaço
+    uint32_t irq_status = save_and_disable_interrupts();
+    int8_t idx;
+    if (stream_pending >= 0) {
+        restore_interrupts(irq_status);
+        return false;
+    }
+    idx = (stream_in_flight == 0) ? 1 : 0;
+    restore_interrupts(irq_status);
+
+    uint32_t bytes_inicio = stats.total_bytes;
+    dirty_window_t windows[ssd1306_n_pages];
+    int n_windows = collect_windows(area, windows);
+    uint16_t *w = dma_stream[idx];
+
+    for (int i = 0; i < n_windows; i++) {
+        const dirty_window_t *win = &windows[i];
+        uint8_t commands[SSD1306_WINDOW_COMMANDS];
+        ssd1306_window_commands(commands, win->col_start, win->col_end, win->page_start, win->page_end);
+        w = stream_put_transaction(w, SSD1306_CONTROL_COMMANDS, commands, SSD1306_WINDOW_COMMANDS);
+
+        // Dados de todas as páginas da janela em uma única transação
+        int width = win->col_end - win->col_start + 1;
+        *w++ = SSD1306_CONTROL_DATA;
+        for (uint8_t page = win->page_start; page <= win->page_end; page++) {
+            const uint8_t *row = window_row(ssd, area, win, page);
+            for (int c = 0; c < width; c++) {
+                *w++ = row[c];
+            }
+        }
+        w[-1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    }
 
-    temp_buffer[0] = 0x40;
-    memcpy(temp_buffer + 1, ssd, buffer_length);
+    // Rolagem pela linha inicial só depois dos dados da página que entra na tela
+    if (pending_start_line >= 0) {
+        uint8_t command = ssd1306_set_display_start_line | pending_start_line;
+        pending_start_line = -1;
+        w = stream_put_transaction(w, SSD1306_CONTROL_COMMANDS, &command, 1);
+    }
 
-    i2c_write_blocking(i2c1, ssd1306_i2c_address, temp_buffer, buffer_length + 1, false);
+    stats.last_frame_windows = n_windows;
 
-    free(temp_buffer);
+    dma_stream_len[idx] = w - dma_stream[idx];
+#if SSD1306_EMU
+    emu_feed_stream(dma_stream[idx], dma_stream_len[idx]);
+#endif
+    stats.total_bytes += dma_stream_len[idx];
+    stats.last_frame_bytes = stats.total_bytes - bytes_inicio;
+    stats.frames++;
+
+    if (dma_stream_len[idx] > 0) {
+        irq_status = save_and_disable_interrupts();
+        if (stream_in_flight >= 0) {
+            stream_pending = idx;     // Sai quando o quadro anterior terminar
+        } else {
+            stream_start(idx);
+        }
+        restore_interrupts(irq_status);
+    }
+
+    stats.last_frame_cpu_us = time_us_64() - inicio;
+    return true;
+}
+
+// Calcular quanto do buffer será destinado à área de renderização
+void calculate_render_area_buffer_length(struct render_area *area) {
+    area->buffer_length = (area->end_column - area->start_column + 1) * (area->end_page - area->start_page + 1);
+}
+
+// Envia uma lista de comandos ao hardware em uma única transação
+void ssd1306_send_command_list(uint8_t *ssd, int number) {
+    ssd1306_async_wait();   // Não intercala com um quadro em transmissão por DMA
+    stats.total_bytes += ssd1306_write_commands(i2c1, ssd1306_i2c_address, ssd, number);
+}
+
+// Processo de escrita do i2c espera um byte de controle, seguido por dados
+void ssd1306_send_command(uint8_t command) {
+    ssd1306_send_command_list(&command, 1);
+}
+
+// Envia o buffer como uma transação de dados: o byte de controle entra direto na FIFO do
+// I2C, sem alocar nem copiar o quadro
+void ssd1306_send_buffer(uint8_t ssd[], int buffer_length) {
+    ssd1306_async_wait();
+    oled_write_data(i2c1, ssd1306_i2c_address, ssd, buffer_length);
+    stats.total_bytes += buffer_length + 1;
 }
 
 // Cria a lista de comandos (com base nos endereços definidos em ssd1306_i2c.h) para a inicialização do display
@@ -86,6 +511,10 @@ void ssd1306_init() {
     };
 
     ssd1306_send_command_list(commands, count_of(commands));
+    pending_start_line = -1;   // A sequência acima já volta a linha inicial para 0
+
+    // Conteúdo da RAM do controlador é indefinido após o reset: o primeiro envio é completo
+    ssd1306_mark_all_dirty();
 }
 
 // Cria a lista de comandos para configurar o scrolling
@@ -98,15 +527,60 @@ void ssd1306_scroll(bool set) {
     ssd1306_send_command_list(commands, count_of(commands));
 }
 
-// Atualiza uma parte do display com uma área de renderização
+// Atualiza uma parte do display com uma área de renderização.
+// Somente as páginas modificadas dentro da área são enviadas, cada uma como uma
+// janela (coluna inicial/final, página) contendo apenas a faixa de colunas alterada.
+// Com o envio assíncrono habilitado, o quadro é entregue ao DMA e a função retorna logo.
 void render_on_display(uint8_t *ssd, struct render_area *area) {
-    uint8_t commands[] = {
-        ssd1306_set_column_address, area->start_column, area->end_column,
-        ssd1306_set_page_address, area->start_page, area->end_page
-    };
+    if (async_enabled) {
+        while (!ssd1306_render_async(ssd, area)) {
+            stream_service();   // Dois quadros na fila: espera o primeiro liberar um buffer
+        }
+        return;
+    }
 
-    ssd1306_send_command_list(commands, count_of(commands));
-    ssd1306_send_buffer(ssd, area->buffer_length);
+    // Burst de dados de uma janela: byte de controle + páginas em sequência
+    static uint8_t window_buffer[1 + ssd1306_buffer_length];
+
+    uint64_t inicio = time_us_64();
+    uint32_t bytes_inicio = stats.total_bytes;
+    dirty_window_t windows[ssd1306_n_pages];
+    int n_windows = collect_windows(area, windows);
+
+    for (int i = 0; i < n_windows; i++) {
+        const dirty_window_t *win = &windows[i];
+        uint8_t commands[SSD1306_WINDOW_COMMANDS];
+        ssd1306_window_commands(commands, win->col_start, win->col_end, win->page_start, win->page_end);
+        ssd1306_send_command_list(commands, SSD1306_WINDOW_COMMANDS);
+
+        int width = win->col_end - win->col_start + 1;
+        int len = 1;
+        window_buffer[0] = SSD1306_CONTROL_DATA;
+        for (uint8_t page = win->page_start; page <= win->page_end; page++) {
+            memcpy(&window_buffer[len], window_row(ssd, area, win, page), width);
+            len += width;
+        }
+        oled_write(i2c1, ssd1306_i2c_address, window_buffer, len);
+        stats.total_bytes += len;
+    }
+
+    if (pending_start_line >= 0) {
+        uint8_t command = ssd1306_set_display_start_line | pending_start_line;
+        pending_start_line = -1;
+        ssd1306_send_command_list(&command, 1);
+    }
+
+    stats.last_frame_windows = n_windows;
+    stats.last_frame_bytes = stats.total_bytes - bytes_inicio;
+    stats.frames++;
+    stats.last_frame_cpu_us = time_us_64() - inicio;
+}
+
+// Agenda a troca da linha inicial do display (0 a 63): a linha `line` da RAM passa a ser
+// o topo da tela. O comando sai no fim do próximo render_on_display(), depois dos dados,
+// e rola a tela inteira sem reenviar nenhum pixel.
+void ssd1306_set_start_line(uint8_t line) {
+    pending_start_line = line & 0x3F;
 }
 
 // Determina o pixel a ser aceso (no display) de acordo com a coordenada fornecida
@@ -125,7 +599,10 @@ void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set) {
         byte &= ~(1 << (y % 8));
     }
 
-    ssd[byte_idx] = byte;
+    if (ssd[byte_idx] != byte) {
+        ssd[byte_idx] = byte;
+        mark_dirty_span(y / 8, x, x);
+    }
 }
 
 // Algoritmo de Bresenham básico
@@ -160,58 +637,71 @@ void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool se
 // Função auxiliar para obter índice da fonte no array `font`
 // ------------------------------------------------------------
 static inline int ssd1306_get_font(uint8_t character) {
-    if (character >= 'A' && character <= 'Z') return character - 'A' + 1;
-    if (character >= '0' && character <= '9') return character - '0' + 27;
-    if (character >= 'a' && character <= 'z') return character - 'a' + 37;
-    if (character == '.') return 63;
-    if (character == ':') return 64;
-    if (character == 0x23) return 65;  // #
-    if (character == 0x21) return 66;  // !
-    if (character == 0x3F) return 67;  // ?
-    if (character == 0xC3) return 68;  // Ã
-    if (character == 0xC2) return 69;  // Â
-    if (character == 0xC1) return 70;  // Á
-    if (character == 0xC0) return 71;  // À
-    if (character == 0xC9) return 72;  // É
-    if (character == 0xCA) return 73;  // Ê
-    if (character == 0xCD) return 74;  // Í
-    if (character == 0xD3) return 75;  // Ó
-    if (character == 0xD4) return 76;  // Ô
-    if (character == 0xD5) return 77;  // Õ
-    if (character == 0xDA) return 78;  // Ú
-    if (character == 0xC7) return 79;  // Ç
-    if (character == 0xE7) return 80;  // ç
-    if (character == 0xE3) return 81;  // ã
-    if (character == 0xE1) return 82;  // á
-    if (character == 0xE0) return 83;  // à
-    if (character == 0xE2) return 84;  // â
-    if (character == 0xE9) return 85;  // é
-    if (character == 0xEA) return 86;  // ê
-    if (character == 0xED) return 87;  // í
-    if (character == 0xF3) return 88;  // ó
-    if (character == 0xF4) return 89;  // ô
-    if (character == 0xFA) return 90;  // ú
-    if (character == 0x2C) return 91;  // ,
-    if (character == '-')  return 92;  // -
-
-    return 0; // caractere vazio/inválido
-}
-
-// Desenha um único caractere no display
-void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character) {
-    if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
+    return font_index[character];   // 0 = caractere vazio/inválido
+}
+
+// Desenha o glifo `idx` com o canto superior em (x, y), y em pixels.
+// Com y alinhado a 8 escreve uma página; caso contrário desloca cada coluna
+// e mescla nas duas páginas cobertas, preservando os bits vizinhos.
+static void draw_glyph(uint8_t *ssd, int16_t x, int16_t y, int idx) {
+    const uint8_t *glyph = &font[idx * 8];
+    uint8_t page = y / 8;
+    uint8_t shift = y % 8;
+    int first_changed = -1, last_changed = -1;
+
+    if (shift == 0) {
+        uint8_t *dst = &ssd[page * ssd1306_width + x];
+        for (int i = 0; i < 8; i++) {
+            if (dst[i] != glyph[i]) {
+                dst[i] = glyph[i];
+                if (first_changed < 0) first_changed = i;
+                last_changed = i;
+            }
+        }
+        // Redesenhar o mesmo caractere não gera tráfego no próximo envio
+        if (first_changed >= 0) {
+            mark_dirty_span(page, x + first_changed, x + last_changed);
+        }
         return;
     }
 
-    y = y / 8;
-
-    //character = toupper(character);
-    int idx = ssd1306_get_font(character);
-    int fb_idx = y * 128 + x;
+    // Página superior: bits shift..7 | página inferior: bits 0..shift-1
+    uint8_t *lo = &ssd[page * ssd1306_width + x];
+    uint8_t *hi = lo + ssd1306_width;
+    uint8_t mask_lo = (uint8_t)(0xFF << shift);
+    uint8_t mask_hi = (uint8_t)~mask_lo;
+    int first_hi = -1, last_hi = -1;
 
     for (int i = 0; i < 8; i++) {
-        ssd[fb_idx++] = font[idx * 8 + i];
+        uint8_t v_lo = (lo[i] & ~mask_lo) | (uint8_t)(glyph[i] << shift);
+        uint8_t v_hi = (hi[i] & ~mask_hi) | (uint8_t)(glyph[i] >> (8 - shift));
+        if (lo[i] != v_lo) {
+            lo[i] = v_lo;
+            if (first_changed < 0) first_changed = i;
+            last_changed = i;
+        }
+        if (hi[i] != v_hi) {
+            hi[i] = v_hi;
+            if (first_hi < 0) first_hi = i;
+            last_hi = i;
+        }
+    }
+
+    if (first_changed >= 0) {
+        mark_dirty_span(page, x + first_changed, x + last_changed);
+    }
+    if (first_hi >= 0) {
+        mark_dirty_span(page + 1, x + first_hi, x + last_hi);
+    }
+}
+
+// Desenha um único caractere no display (y em pixels, não precisa ser múltiplo de 8)
+void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character) {
+    if (x < 0 || y < 0 || x > ssd1306_width - 8 || y > ssd1306_height - 8) {
+        return;
     }
+
+    draw_glyph(ssd, x, y, ssd1306_get_font(character));
 }
 
 // Desenha uma string, chamando a função de desenhar caractere várias vezes
@@ -226,40 +716,39 @@ void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, char *string) {
     }
 }
 
+// Envia uma lista de comandos em uma única transação (byte de controle Co=0)
+void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, int number) {
+    ssd1306_async_wait();   // i2c_write_blocking() reprograma o IC_TAR e cortaria um quadro do DMA
+    ssd->bytes_sent += ssd1306_write_commands(ssd->i2c_port, ssd->address, commands, number);
+}
+
 // Comando de configuração com base na estrutura ssd1306_t
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
-  ssd->port_buffer[1] = command;
-  i2c_write_blocking(
-	ssd->i2c_port, ssd->address, ssd->port_buffer, 2, false );
+    ssd1306_command_list(ssd, &command, 1);
 }
 
 // Função de configuração do display para o caso do bitmap
 void ssd1306_config(ssd1306_t *ssd) {
-    ssd1306_command(ssd, ssd1306_set_display | 0x00);
-    ssd1306_command(ssd, ssd1306_set_memory_mode);
-    ssd1306_command(ssd, 0x01);
-    ssd1306_command(ssd, ssd1306_set_display_start_line | 0x00);
-    ssd1306_command(ssd, ssd1306_set_segment_remap | 0x01);
-    ssd1306_command(ssd, ssd1306_set_mux_ratio);
-    ssd1306_command(ssd, ssd1306_height - 1);
-    ssd1306_command(ssd, ssd1306_set_common_output_direction | 0x08);
-    ssd1306_command(ssd, ssd1306_set_display_offset);
-    ssd1306_command(ssd, 0x00);
-    ssd1306_command(ssd, ssd1306_set_common_pin_configuration);
-    ssd1306_command(ssd, 0x12);
-    ssd1306_command(ssd, ssd1306_set_display_clock_divide_ratio);
-    ssd1306_command(ssd, 0x80);
-    ssd1306_command(ssd, ssd1306_set_precharge);
-    ssd1306_command(ssd, 0xF1);
-    ssd1306_command(ssd, ssd1306_set_vcomh_deselect_level);
-    ssd1306_command(ssd, 0x30);
-    ssd1306_command(ssd, ssd1306_set_contrast);
-    ssd1306_command(ssd, 0xFF);
-    ssd1306_command(ssd, ssd1306_set_entire_on);
-    ssd1306_command(ssd, ssd1306_set_normal_display);
-    ssd1306_command(ssd, ssd1306_set_charge_pump);
-    ssd1306_command(ssd, 0x14);
-    ssd1306_command(ssd, ssd1306_set_display | 0x01);
+    const uint8_t commands[] = {
+        ssd1306_set_display | 0x00,
+        ssd1306_set_memory_mode, 0x01,
+        ssd1306_set_display_start_line | 0x00,
+        ssd1306_set_segment_remap | 0x01,
+        ssd1306_set_mux_ratio, ssd1306_height - 1,
+        ssd1306_set_common_output_direction | 0x08,
+        ssd1306_set_display_offset, 0x00,
+        ssd1306_set_common_pin_configuration, 0x12,
+        ssd1306_set_display_clock_divide_ratio, 0x80,
+        ssd1306_set_precharge, 0xF1,
+        ssd1306_set_vcomh_deselect_level, 0x30,
+        ssd1306_set_contrast, 0xFF,
+        ssd1306_set_entire_on,
+        ssd1306_set_normal_display,
+        ssd1306_set_charge_pump, 0x14,
+        ssd1306_set_display | 0x01,
+    };
+
+    ssd1306_command_list(ssd, commands, count_of(commands));
 }
 
 // Inicializa o display para o caso de exibição de bitmap
@@ -271,99 +760,163 @@ void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool externa
     ssd->i2c_port = i2c;
     ssd->bufsize = ssd->pages * ssd->width + 1;
     ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
-    ssd->ram_buffer[0] = 0x40;
-    ssd->port_buffer[0] = 0x80;
+    ssd->ram_buffer[0] = SSD1306_CONTROL_DATA;
+    ssd->port_buffer[0] = SSD1306_CONTROL_COMMANDS;
+    ssd->bytes_sent = 0;
 }
 
 // Envia os dados ao display
 void ssd1306_send_data(ssd1306_t *ssd) {
-    ssd1306_command(ssd, ssd1306_set_column_address);
-    ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->width - 1);
-    ssd1306_command(ssd, ssd1306_set_page_address);
-    ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->pages - 1);
-    i2c_write_blocking(
-    ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize, false );
+    uint8_t commands[SSD1306_WINDOW_COMMANDS];
+    ssd1306_window_commands(commands, 0, ssd->width - 1, 0, ssd->pages - 1);
+    ssd1306_command_list(ssd, commands, SSD1306_WINDOW_COMMANDS);
+    ssd1306_async_wait();
+    oled_write(ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize);
+    ssd->bytes_sent += ssd->bufsize;
 }
 
-// Desenha o bitmap (a ser fornecido em display_oled.c) no display
+// Desenha o bitmap (a ser fornecido em display_oled.c) no display: copia a tela
+// inteira para ram_buffer e faz um único envio
 void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap) {
-    for (int i = 0; i < ssd->bufsize - 1; i++) {
-        ssd->ram_buffer[i + 1] = bitmap[i];
+    memcpy(ssd->ram_buffer + 1, bitmap, ssd->bufsize - 1);
+    ssd1306_send_data(ssd);
+}
 
-        ssd1306_send_data(ssd);
+// Combina um byte (coluna de 8 pixels) com o destino; `mask` limita os bits afetados
+static inline void blit_byte(uint8_t *dst, uint8_t bits, uint8_t mask, ssd1306_blit_mode_t mode) {
+    bits &= mask;
+    switch (mode) {
+        case SSD1306_BLIT_COPY: *dst = (*dst & ~mask) | bits; break;
+        case SSD1306_BLIT_OR:   *dst |= bits;                 break;
+        case SSD1306_BLIT_AND:  *dst &= bits | ~mask;         break;
+        case SSD1306_BLIT_XOR:  *dst ^= bits;                 break;
     }
 }
 
-// Função que converte string UTF-8 para Latin-1 e imprime no OLED
-void ssd1306_draw_utf8_string(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string) {
-    if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
+// Copia um sprite para ram_buffer na posição (x, y), com recorte nas bordas da tela.
+// Não envia nada ao display: após compor o quadro, chame ssd1306_send_data() uma vez.
+//
+// No modo bitmap (ssd1306_config) o endereçamento é vertical, então ram_buffer é
+// organizado por colunas: o byte da coluna x, página p fica em ram_buffer[1 + x * pages + p].
+void ssd1306_blit(ssd1306_t *ssd, const ssd1306_sprite_t *sprite, int x, int y, ssd1306_blit_mode_t mode) {
+    int sprite_pages = (sprite->height + 7) / 8;
+
+    // Recorte horizontal
+    int col_ini = x < 0 ? -x : 0;
+    int col_fim = MIN(sprite->width, ssd->width - x);
+    if (col_ini >= col_fim || y >= ssd->height || y + sprite->height <= 0) {
         return;
     }
 
-    while (*utf8_string) {
-        uint8_t c = (uint8_t)*utf8_string;
-
-        if ((c & 0x80) == 0) {
-            // ASCII puro (0x00–0x7F)
-            ssd1306_draw_char(ssd, x, y, c);
-            utf8_string++;
+    // Deslocamento vertical: página de destino da primeira linha e bits dentro dela
+    int page_base = (y >= 0) ? y / 8 : -((7 - y) / 8);
+    int shift = y - page_base * 8;
+    uint8_t *base = ssd->ram_buffer + 1;
+
+    for (int sp = 0; sp < sprite_pages; sp++) {
+        // Bits válidos desta página do sprite (a última pode estar incompleta)
+        int linhas = MIN(8, sprite->height - sp * 8);
+        uint8_t mask = (uint8_t)((1u << linhas) - 1);
+        const uint8_t *src = sprite->data + sp * sprite->width;
+        int dp = page_base + sp;
+
+        if (shift == 0) {
+            // Caminho rápido: y alinhado à página, um byte do sprite = um byte do destino
+            if (dp < 0 || dp >= ssd->pages) continue;
+            for (int c = col_ini; c < col_fim; c++) {
+                blit_byte(&base[(x + c) * ssd->pages + dp], src[c], mask, mode);
+            }
+            continue;
         }
-        else if ((c & 0xE0) == 0xC0) {
-            // UTF-8 de 2 bytes (ex: ç, é, ã, ó)
-            uint8_t first = (uint8_t)*utf8_string++;
-            uint8_t second = (uint8_t)*utf8_string++;
 
-            // Reconstrói o código Latin-1 correspondente
-            uint8_t latin1 = ((first & 0x1F) << 6) | (second & 0x3F);
+        // y desalinhado: cada byte se divide entre a página dp (parte baixa) e dp + 1 (parte alta)
+        uint8_t mask_lo = (uint8_t)(mask << shift);
+        uint8_t mask_hi = (uint8_t)(mask >> (8 - shift));
+        bool usa_lo = dp >= 0 && dp < ssd->pages;
+        bool usa_hi = dp + 1 >= 0 && dp + 1 < ssd->pages && mask_hi;
 
-            ssd1306_draw_char(ssd, x, y, latin1);
-        }
-        else {
-            // UTF-8 de 3+ bytes não suportado: pula
-            utf8_string++;
+        for (int c = col_ini; c < col_fim; c++) {
+            uint8_t *coluna = &base[(x + c) * ssd->pages];
+            if (usa_lo) blit_byte(&coluna[dp], (uint8_t)(src[c] << shift), mask_lo, mode);
+            if (usa_hi) blit_byte(&coluna[dp + 1], (uint8_t)(src[c] >> (8 - shift)), mask_hi, mode);
         }
+    }
+}
+
+// Decodifica um caractere UTF-8 para Latin-1 e avança o ponteiro.
+// Sequências fora do Latin-1 (3+ bytes, bytes soltos) viram um espaço vazio.
+static uint8_t utf8_next_latin1(const char **p) {
+    const uint8_t *s = (const uint8_t *)*p;
+    uint8_t c = *s++;
+
+    if ((c & 0x80) == 0) {
+        // ASCII puro (0x00–0x7F)
+    }
+    else if ((c & 0xE0) == 0xC0 && (*s & 0xC0) == 0x80) {
+        // UTF-8 de 2 bytes (ex: ç, é, ã, ó) → código Latin-1 correspondente
+        c = (uint8_t)(((c & 0x1F) << 6) | (*s++ & 0x3F));
+    }
+    else {
+        // Não suportado: consome os bytes de continuação da sequência
+        while ((*s & 0xC0) == 0x80) s++;
+        c = ' ';
+    }
+
+    *p = (const char *)s;
+    return c;
+}
 
-        x += 8; // Avança 8 pixels por caractere
+// Decodifica a string UTF-8 uma única vez, guardando os índices dos glifos
+int ssd1306_text_prepare(ssd1306_text_t *text, const char *utf8_string) {
+    text->length = 0;
+    while (*utf8_string && text->length < SSD1306_TEXT_MAX) {
+        text->glyphs[text->length++] = font_index[utf8_next_latin1(&utf8_string)];
     }
+    return text->length;
 }
 
-void ssd1306_draw_utf8_multiline(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string) {
-    const int max_width = ssd1306_width;
-    const int max_height = ssd1306_height;
-    const int char_width = 8;
-    const int char_height = 8;
-
-    while (*utf8_string && y <= (max_height - char_height)) {
-        uint8_t c = (uint8_t)*utf8_string;
-
-        if ((c & 0x80) == 0) {
-            // ASCII puro
-            ssd1306_draw_char(ssd, x, y, c);
-            utf8_string++;
-        }
-        else if ((c & 0xE0) == 0xC0) {
-            // UTF-8 de 2 bytes → Latin-1
-            uint8_t first = (uint8_t)*utf8_string++;
-            uint8_t second = (uint8_t)*utf8_string++;
-            uint8_t latin1 = ((first & 0x1F) << 6) | (second & 0x3F);
-            ssd1306_draw_char(ssd, x, y, latin1);
-        }
-        else {
-            // Ignora UTF-8 > 2 bytes
-            utf8_string++;
-        }
+// Desenha um texto pré-decodificado em uma linha, a partir de (x, y) em pixels
+void ssd1306_draw_text(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_text_t *text) {
+    if (x < 0 || y < 0 || y > ssd1306_height - 8) {
+        return;
+    }
 
-        x += char_width;
+    for (int i = 0; i < text->length && x <= ssd1306_width - 8; i++) {
+        draw_glyph(ssd, x, y, text->glyphs[i]);
+        x += 8;
+    }
+}
 
-        if (x > (max_width - char_width)) {
+// Desenha um texto pré-decodificado quebrando linha ao atingir a borda direita
+void ssd1306_draw_text_multiline(uint8_t *ssd, int16_t x, int16_t y, const ssd1306_text_t *text) {
+    if (x < 0 || y < 0 || x > ssd1306_width - 8) {
+        return;
+    }
+
+    for (int i = 0; i < text->length && y <= ssd1306_height - 8; i++) {
+        draw_glyph(ssd, x, y, text->glyphs[i]);
+        x += 8;
+
+        if (x > ssd1306_width - 8) {
             x = 0;
-            y += char_height;
+            y += 8;
         }
     }
 }
 
+// Função que converte string UTF-8 para Latin-1 e imprime no OLED
+void ssd1306_draw_utf8_string(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string) {
+    ssd1306_text_t text;
+    ssd1306_text_prepare(&text, utf8_string);
+    ssd1306_draw_text(ssd, x, y, &text);
+}
+
+void ssd1306_draw_utf8_multiline(uint8_t *ssd, int16_t x, int16_t y, const char *utf8_string) {
+    ssd1306_text_t text;
+    ssd1306_text_prepare(&text, utf8_string);
+    ssd1306_draw_text_multiline(ssd, x, y, &text);
+}
+
 /**/
 
 void ssd1306_clear_area(uint8_t *buffer, uint8_t x_start, uint8_t y_start, uint8_t x_end, uint8_t y_end) {
@@ -378,5 +931,7 @@ void ssd1306_clear_area(uint8_t *buffer, uint8_t x_start, uint8_t y_start, uint8
             }
         }
     }
+
+    ssd1306_mark_dirty(x_start, y_start, x_end, y_end);
 }
 
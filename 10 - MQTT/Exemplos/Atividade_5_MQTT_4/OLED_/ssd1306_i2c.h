@@ -13,6 +13,10 @@
  * - Estrutura `render_area` para delimitar áreas específicas da tela a serem renderizadas.
  * - Estrutura `ssd1306_t` que encapsula propriedades da tela e ponteiros para buffers.
  * - Funções para desenhar texto UTF-8: `ssd1306_draw_utf8_string()` e `ssd1306_draw_utf8_multiline()`.
+ * - Estrutura `ssd1306_text_t` com textos já decodificados em índices de glifo, para redesenho rápido.
+ * - Estrutura `ssd1306_stats_t` com o tráfego I²C (bytes por quadro) do envio parcial.
+ * - Estruturas `ssd1306_sprite_t` e `ssd1306_blit_mode_t` para cópia de sprites em `ram_buffer`.
+ * - Tipo `ssd1306_async_callback_t` para notificação de fim de quadro enviado por DMA.
  *
  * Este módulo é base para projetos gráficos embarcados com microcontroladores, como o Raspberry Pi Pico,
  * oferecendo controle direto e de baixo nível sobre o display OLED via comandos SSD1306 padronizados.
@@ -72,6 +76,9 @@ void ssd1306_clear_area(uint8_t *buffer, uint8_t x_start, uint8_t y_start, uint8
 #define ssd1306_n_pages (ssd1306_height / ssd1306_page_height)
 #define ssd1306_buffer_length (ssd1306_n_pages * ssd1306_width)
 
+// Comandos de uma janela de escrita: coluna inicial/final e página inicial/final
+#define SSD1306_WINDOW_COMMANDS 6
+
 #define ssd1306_write_mode _u(0xFE)
 #define ssd1306_read_mode _u(0xFF)
 
@@ -91,6 +98,43 @@ typedef struct {
   uint8_t *ram_buffer;
   size_t bufsize;
   uint8_t port_buffer[2];
+  uint32_t bytes_sent;      // Bytes enviados pelo I2C (comandos + dados) desde ssd1306_init_bm()
 } ssd1306_t;
 
+// Sprite monocromático no formato de página do SSD1306: (height + 7) / 8 linhas de
+// `width` bytes, cada byte uma coluna de 8 pixels com o bit menos significativo no topo
+typedef struct {
+    uint8_t width, height;
+    const uint8_t *data;
+} ssd1306_sprite_t;
+
+// Texto UTF-8 decodificado uma única vez em índices de `font[]` (ver ssd1306_text_prepare)
+// A tela inteira: 8 páginas de 16 caracteres de 8 pixels = 128 glifos
+#define SSD1306_TEXT_MAX (ssd1306_n_pages * ssd1306_width / 8)
+
+typedef struct {
+    uint8_t glyphs[SSD1306_TEXT_MAX];
+    uint8_t length;
+} ssd1306_text_t;
+
+// Como os pixels do sprite são combinados com o conteúdo de ram_buffer
+typedef enum {
+    SSD1306_BLIT_COPY,  // Substitui os pixels cobertos pelo sprite
+    SSD1306_BLIT_OR,    // Acende os pixels acesos do sprite
+    SSD1306_BLIT_AND,   // Mantém apenas os pixels acesos em ambos (máscara)
+    SSD1306_BLIT_XOR    // Inverte os pixels acesos do sprite
+} ssd1306_blit_mode_t;
+
+// Estatísticas de tráfego I2C do modo render_area (envio parcial por páginas)
+typedef struct {
+    uint32_t last_frame_bytes;    // Bytes enviados no último render_on_display()
+    uint32_t last_frame_windows;  // Janelas (páginas) enviadas no último quadro
+    uint32_t total_bytes;         // Bytes enviados desde a inicialização (comandos + dados)
+    uint32_t frames;              // Número de chamadas a render_on_display()
+    uint32_t last_frame_cpu_us;   // Tempo de CPU gasto no último envio (bloqueante ou DMA)
+} ssd1306_stats_t;
+
+// Função chamada ao fim de um quadro enviado por DMA (IRQ do DMA ou polling)
+typedef void (*ssd1306_async_callback_t)(void *ctx);
+
 #endif
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include "configura_geral.h"
 #include "display_utils.h"
 #include "mqtt_lwip.h"
+#include "rgb_pwm_control.h"
 
 // ========================
 // VARIÁVEIS GLOBAIS INTERNAS
@@ -79,8 +80,11 @@ static void mqtt_mensagem_cb(void *arg, const char *topic, u32_t tot_len) {
  * - Controle do LED RGB (via TOPICO_COMANDO_RGB)
  */
 static void mqtt_dados_cb(void *arg, const u8_t *data, u16_t len, u8_t flags) {
-    char buffer[16] = {0};
-    memcpy(buffer, data, len < sizeof(buffer) - 1 ? len : sizeof(buffer) - 1);
+    char buffer[40] = {0};
+    if (len > sizeof(buffer) - 1) {
+        len = sizeof(buffer) - 1;
+    }
+    memcpy(buffer, data, len);
     buffer[len] = '\0';  // Garante terminação nula
 
     // --- Comando para alterar o intervalo do PING ---
@@ -96,21 +100,16 @@ static void mqtt_dados_cb(void *arg, const u8_t *data, u16_t len, u8_t flags) {
 
     // --- Comando para controlar o LED RGB ---
     else if (strncmp(topico_recebido, TOPICO_COMANDO_RGB, strlen(TOPICO_COMANDO_RGB)) == 0) {
-        uint16_t cor = 0xFFFF;
-
-        if      (strcasecmp(buffer, "APAGAR")     == 0) cor = 0;
-        else if (strcasecmp(buffer, "AZUL")     == 0) cor = 1;
-        else if (strcasecmp(buffer, "VERDE")   == 0) cor = 2;
-        else if (strcasecmp(buffer, "CIANO")  == 0) cor = 3;
-        else if (strcasecmp(buffer, "VERMELHO")    == 0) cor = 4;
-        else if (strcasecmp(buffer, "MAGENTA") == 0) cor = 5;
-        else if (strcasecmp(buffer, "AMARELO")    == 0) cor = 6;
-        else if (strcasecmp(buffer, "BRANCO")   == 0) cor = 7;
-
-        if (cor <= 7) {
-            uint32_t pacote = (0xB1B1 << 16) | cor;
-            multicore_fifo_push_blocking(pacote);
-            printf("[MQTT] Comando RGB recebido: %s (código %u)\n", buffer, cor);
+        // "<cor> [duração_ms] [suavização]": a transição é feita no núcleo 0, que recebe
+        // duas palavras (comando + duração, depois suavização + cor 0xRRGGBB)
+        uint32_t cor, duracao_ms;
+        rgb_suavizacao_t suavizacao;
+
+        if (rgb_interpreta_comando(buffer, &cor, &duracao_ms, &suavizacao)) {
+            multicore_fifo_push_blocking((0xB1B2 << 16) | (duracao_ms & 0xFFFF));
+            multicore_fifo_push_blocking(((uint32_t)suavizacao << 24) | cor);
+            printf("[MQTT] Comando RGB recebido: %s (#%06X em %u ms)\n", buffer,
+                   (unsigned)cor, (unsigned)duracao_ms);
         } else {
             printf("[MQTT] Comando RGB inválido: %s\n", buffer);
         }
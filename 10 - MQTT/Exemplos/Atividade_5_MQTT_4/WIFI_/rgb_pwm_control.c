@@ -1,9 +1,107 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "hardware/dma.h"
+#include "hardware/clocks.h"
 #include "rgb_pwm_control.h"
 
 static uint slice_r, slice_g, slice_b;
 
+// Gama de 8 bits lineares para nível de 16 bits do PWM
+static uint16_t gama[256];
+
+// Rampas: uma palavra de CC por passo para cada slice distinto usado pelos LEDs, cada uma
+// copiada por um canal DMA. CC guarda os canais A (16 bits baixos) e B (16 bits altos);
+// a escrita de 32 bits atualiza os dois de uma vez, o que permite dois LEDs no mesmo slice
+// (R e B no slice 6 da BitDogLab: dois canais DMA no total).
+static uint32_t rampa[3][RGB_PASSOS];
+static volatile uint32_t *destino[3];
+static uint n_canais = 0;
+static int dma_rampa[3] = { -1, -1, -1 };
+static uint canal_do_led[3];         // Rampa (slice) de R, G e B
+static uint desloc_do_led[3];        // 0 = canal A, 16 = canal B
+
+static uint32_t cor_origem = 0, cor_alvo = 0;
+static rgb_suavizacao_t suavizacao_atual = RGB_LINEAR;
+
+// Cores com nome (as mesmas do comando antigo)
+static const struct {
+    const char *nome;
+    uint32_t cor;
+} cores_nomeadas[] = {
+    { "APAGAR",   0x000000 }, { "AZUL",    0x0000FF }, { "VERDE",   0x00FF00 },
+    { "CIANO",    0x00FFFF }, { "VERMELHO", 0xFF0000 }, { "MAGENTA", 0xFF00FF },
+    { "AMARELO",  0xFFFF00 }, { "BRANCO",  0xFFFFFF },
+};
+
+static inline uint8_t canal(uint32_t cor, int deslocamento) {
+    return (cor >> deslocamento) & 0xFF;
+}
+
+// Curva de suavização em ponto fixo: t e o resultado em 0..65536
+static uint32_t suaviza(uint32_t t, rgb_suavizacao_t s) {
+    uint64_t t2 = (uint64_t)t * t >> 16;
+    switch (s) {
+        case RGB_ENTRADA:       return (uint32_t)t2;
+        case RGB_SAIDA:         return 65536 - (uint32_t)((uint64_t)(65536 - t) * (65536 - t) >> 16);
+        case RGB_ENTRADA_SAIDA: return (uint32_t)((t2 * (3 * 65536 - 2 * (uint64_t)t)) >> 16);
+        default:                return t;
+    }
+}
+
+// Nível de 16 bits com gama para o valor linear em 8.8, interpolando entre entradas da tabela
+static uint16_t nivel_gama(uint32_t v88) {
+    uint32_t i = v88 >> 8, f = v88 & 0xFF;
+    if (i >= 255) {
+        return gama[255];
+    }
+    return (uint16_t)(gama[i] + (((uint32_t)(gama[i + 1] - gama[i]) * f) >> 8));
+}
+
+// Cor linear (8.8 por canal) no passo k da rampa atual
+static void cor_no_passo(uint k, uint32_t v88[3]) {
+    uint32_t p = suaviza((uint32_t)((k + 1) * 65536u / RGB_PASSOS), suavizacao_atual);
+    for (int c = 0; c < 3; c++) {
+        int32_t a = canal(cor_origem, 16 - 8 * c) << 8;
+        int32_t b = canal(cor_alvo, 16 - 8 * c) << 8;
+        v88[c] = (uint32_t)(a + (int32_t)(((int64_t)(b - a) * p) >> 16));
+    }
+}
+
+// Escreve os níveis (16 bits) de R, G e B nas palavras de CC do passo k
+static void grava_passo(uint k, const uint16_t nivel[3]) {
+    for (uint i = 0; i < n_canais; i++) {
+        rampa[i][k] = 0;
+    }
+    for (int c = 0; c < 3; c++) {
+        rampa[canal_do_led[c]][k] |= (uint32_t)nivel[c] << desloc_do_led[c];
+    }
+}
+
+static void para_dma(void) {
+    for (uint i = 0; i < n_canais; i++) {
+        dma_channel_abort(dma_rampa[i]);
+    }
+}
+
+// Cor linear que está no LED agora (no meio de uma transição, a do passo em curso)
+static uint32_t cor_atual(void) {
+    if (!rgb_em_transicao()) {
+        return cor_alvo;
+    }
+    uint restantes = dma_channel_hw_addr(dma_rampa[0])->transfer_count;
+    uint k = RGB_PASSOS - restantes;
+    if (k == 0) {
+        return cor_origem;   // Nenhum passo aplicado ainda
+    }
+    uint32_t v88[3];
+    cor_no_passo(k - 1, v88);
+    return ((v88[0] >> 8) << 16) | ((v88[1] >> 8) << 8) | (v88[2] >> 8);
+}
+
 void init_rgb_pwm() {
-    
+
     gpio_set_function(LED_R, GPIO_FUNC_PWM);
     gpio_set_function(LED_G, GPIO_FUNC_PWM);
     gpio_set_function(LED_B, GPIO_FUNC_PWM);
@@ -18,10 +116,182 @@ void init_rgb_pwm() {
     pwm_init(slice_r, &config, true);
     pwm_init(slice_g, &config, true);
     pwm_init(slice_b, &config, true);
+
+    for (int v = 0; v < 256; v++) {
+        gama[v] = (uint16_t)(powf(v / 255.0f, RGB_GAMA) * PWM_STEP + 0.5f);
+    }
+
+    // Um canal DMA por slice distinto entre os três LEDs
+    const uint pinos[3] = { LED_R, LED_G, LED_B };
+    const uint slices[3] = { slice_r, slice_g, slice_b };
+    uint slice_do_canal[3];
+    n_canais = 0;
+    for (int c = 0; c < 3; c++) {
+        uint i = 0;
+        while (i < n_canais && slice_do_canal[i] != slices[c]) {
+            i++;
+        }
+        if (i == n_canais) {
+            slice_do_canal[n_canais] = slices[c];
+            destino[n_canais] = &pwm_hw->slice[slices[c]].cc;
+            n_canais++;
+        }
+        canal_do_led[c] = i;
+        desloc_do_led[c] = (pwm_gpio_to_channel(pinos[c]) == PWM_CHAN_B) ? 16 : 0;
+    }
+
+    for (uint i = 0; i < n_canais; i++) {
+        dma_rampa[i] = dma_claim_unused_channel(true);
+        dma_channel_config cfg = dma_channel_get_default_config(dma_rampa[i]);
+        channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+        channel_config_set_read_increment(&cfg, true);
+        channel_config_set_write_increment(&cfg, false);
+        channel_config_set_dreq(&cfg, DREQ_PWM_WRAP0 + RGB_SLICE_RITMO);
+        dma_channel_configure(dma_rampa[i], &cfg, destino[i], rampa[i], RGB_PASSOS, false);
+    }
 }
 
+/**
+ * @brief Define a cor na hora (cancela a transição em curso).
+ *
+ * Mantém a interface antiga em níveis de 16 bits: o byte alto de cada canal é tratado
+ * como cor linear, então 0 e PWM_STEP continuam apagado e aceso.
+ */
 void set_rgb_pwm(uint16_t r_val, uint16_t g_val, uint16_t b_val) {
-    pwm_set_gpio_level(LED_R, r_val);
-    pwm_set_gpio_level(LED_G, g_val);
-    pwm_set_gpio_level(LED_B, b_val);
-}
\ No newline at end of file
+    rgb_transicao(((uint32_t)(r_val >> 8) << 16) | ((g_val >> 8) << 8) | (b_val >> 8), 0, RGB_LINEAR);
+}
+
+/**
+ * @brief Leva o LED da cor atual até `cor` (0xRRGGBB) em `duracao_ms`.
+ *
+ * Uma transição em curso é interrompida e a nova parte da cor em que ela estava.
+ * A rampa é calculada aqui; os passos são aplicados pelo DMA no ritmo do slice
+ * RGB_SLICE_RITMO. Com duração 0 a cor é aplicada na hora.
+ */
+void rgb_transicao(uint32_t cor, uint32_t duracao_ms, rgb_suavizacao_t suavizacao) {
+    uint32_t partida = cor_atual();
+    para_dma();
+
+    cor_origem = partida;
+    cor_alvo = cor & 0xFFFFFF;
+    suavizacao_atual = suavizacao;
+
+    if (duracao_ms > RGB_DURACAO_MAX_MS) {
+        duracao_ms = RGB_DURACAO_MAX_MS;
+    }
+
+    if (duracao_ms == 0) {
+        uint16_t nivel[3] = {
+            gama[canal(cor_alvo, 16)], gama[canal(cor_alvo, 8)], gama[canal(cor_alvo, 0)]
+        };
+        grava_passo(RGB_PASSOS - 1, nivel);
+        for (uint i = 0; i < n_canais; i++) {
+            *destino[i] = rampa[i][RGB_PASSOS - 1];
+        }
+        return;
+    }
+
+    for (uint k = 0; k < RGB_PASSOS; k++) {
+        uint32_t v88[3];
+        cor_no_passo(k, v88);
+        uint16_t nivel[3] = { nivel_gama(v88[0]), nivel_gama(v88[1]), nivel_gama(v88[2]) };
+        grava_passo(k, nivel);
+    }
+
+    // Ritmo: RGB_PASSOS wraps em duracao_ms (divisor inteiro de 1 a 255, wrap de 16 bits)
+    float ciclos = (float)clock_get_hz(clk_sys) * duracao_ms / (1000.0f * RGB_PASSOS);
+    float div = ciclos / 65536.0f;
+    div = div < 1.0f ? 1.0f : div > 255.0f ? 255.0f : (float)(int)(div + 1.0f);
+    pwm_set_enabled(RGB_SLICE_RITMO, false);
+    pwm_set_clkdiv(RGB_SLICE_RITMO, div);
+    pwm_set_wrap(RGB_SLICE_RITMO, (uint16_t)(ciclos / div) - 1);
+    pwm_set_counter(RGB_SLICE_RITMO, 0);
+
+    uint32_t mascara = 0;
+    for (uint i = 0; i < n_canais; i++) {
+        dma_channel_set_read_addr(dma_rampa[i], rampa[i], false);
+        dma_channel_set_trans_count(dma_rampa[i], RGB_PASSOS, false);
+        mascara |= 1u << dma_rampa[i];
+    }
+    dma_start_channel_mask(mascara);
+    pwm_set_enabled(RGB_SLICE_RITMO, true);
+}
+
+bool rgb_em_transicao(void) {
+    return n_canais && dma_channel_is_busy(dma_rampa[0]);
+}
+
+uint32_t rgb_cor_alvo(void) {
+    return cor_alvo;
+}
+
+/**
+ * @brief Interpreta "<cor> [duração_ms] [suavização]".
+ *
+ * A cor é um nome (AZUL, VERMELHO, ..., APAGAR) ou hexadecimal "#RRGGBB" / "RRGGBB".
+ * Sem duração vale 500 ms. A suavização é "linear", "entrada", "saida" ou "suave"
+ * (padrão). Ex: "#FF8000 2000", "azul 300 linear", "000000".
+ */
+bool rgb_interpreta_comando(const char *texto, uint32_t *cor, uint32_t *duracao_ms,
+                            rgb_suavizacao_t *suavizacao) {
+    char copia[40];
+    strncpy(copia, texto, sizeof(copia) - 1);
+    copia[sizeof(copia) - 1] = '\0';
+
+    char *resto = NULL;
+    char *palavra = strtok_r(copia, " ,;", &resto);
+    if (!palavra) {
+        return false;
+    }
+
+    bool achou = false;
+    for (size_t i = 0; i < sizeof(cores_nomeadas) / sizeof(cores_nomeadas[0]); i++) {
+        if (strcasecmp(palavra, cores_nomeadas[i].nome) == 0) {
+            *cor = cores_nomeadas[i].cor;
+            achou = true;
+            break;
+        }
+    }
+    if (!achou) {
+        const char *hex = (palavra[0] == '#') ? palavra + 1 : palavra;
+        char *fim;
+        unsigned long v = strtoul(hex, &fim, 16);
+        if (strlen(hex) != 6 || *fim != '\0') {
+            return false;
+        }
+        *cor = (uint32_t)v;
+    }
+
+    *duracao_ms = 500;
+    *suavizacao = RGB_ENTRADA_SAIDA;
+
+    palavra = strtok_r(NULL, " ,;", &resto);
+    if (palavra) {
+        char *fim;
+        unsigned long ms = strtoul(palavra, &fim, 10);
+        if (*fim != '\0' || ms > RGB_DURACAO_MAX_MS) {
+            return false;
+        }
+        *duracao_ms = (uint32_t)ms;
+        palavra = strtok_r(NULL, " ,;", &resto);
+    }
+
+    if (palavra) {
+        if      (strcasecmp(palavra, "linear")  == 0) *suavizacao = RGB_LINEAR;
+        else if (strcasecmp(palavra, "entrada") == 0) *suavizacao = RGB_ENTRADA;
+        else if (strcasecmp(palavra, "saida")   == 0) *suavizacao = RGB_SAIDA;
+        else if (strcasecmp(palavra, "suave")   == 0) *suavizacao = RGB_ENTRADA_SAIDA;
+        else return false;
+    }
+    return true;
+}
+
+// Nome da cor, se for uma das cores nomeadas (NULL caso contrário)
+const char *rgb_nome_da_cor(uint32_t cor) {
+    for (size_t i = 0; i < sizeof(cores_nomeadas) / sizeof(cores_nomeadas[0]); i++) {
+        if (cores_nomeadas[i].cor == cor) {
+            return cores_nomeadas[i].nome;
+        }
+    }
+    return NULL;
+}
@@ -3,7 +3,37 @@
 
 #include "configura_geral.h"
 
+/**
+ * Controle do LED RGB com transições feitas por DMA.
+ *
+ * rgb_transicao() gera uma rampa de RGB_PASSOS níveis (cor atual -> cor alvo, com a curva
+ * de suavização escolhida e correção gama) e dois canais DMA a copiam para os registradores
+ * de comparação dos slices do LED, um passo por wrap de um slice PWM usado só como ritmo.
+ * A CPU só calcula a rampa no início; a transição segue sozinha até o fim.
+ *
+ * Cores são 0xRRGGBB em escala linear de 8 bits; a gama é aplicada na saída (16 bits).
+ */
+
+#define RGB_PASSOS 128             // Níveis da rampa
+#define RGB_DURACAO_MAX_MS 15000   // 128 passos no ritmo mais lento do slice (~7,5 Hz a 125 MHz) = ~17 s
+#define RGB_GAMA 2.2f
+
+typedef enum {
+    RGB_LINEAR,
+    RGB_ENTRADA,        // Começa devagar (t^2)
+    RGB_SAIDA,          // Termina devagar
+    RGB_ENTRADA_SAIDA   // Suave nas duas pontas (smoothstep)
+} rgb_suavizacao_t;
+
 void init_rgb_pwm();
 void set_rgb_pwm(uint16_t r_val, uint16_t g_val, uint16_t b_val);
 
-#endif
\ No newline at end of file
+void rgb_transicao(uint32_t cor, uint32_t duracao_ms, rgb_suavizacao_t suavizacao);
+bool rgb_em_transicao(void);
+uint32_t rgb_cor_alvo(void);
+
+bool rgb_interpreta_comando(const char *texto, uint32_t *cor, uint32_t *duracao_ms,
+                            rgb_suavizacao_t *suavizacao);
+const char *rgb_nome_da_cor(uint32_t cor);
+
+#endif
@@ -17,11 +17,15 @@
 #define LED_B 12
 #define PWM_STEP 0xFFFF
 //#define PWM_STEP (1 << 8)
+#define RGB_SLICE_RITMO 0   // Slice sem pino que dita o ritmo das transições do LED RGB (DMA)
 
 //Pinos I2C
 #define SDA_PIN 14
 #define SCL_PIN 15
 
+// Mede na inicialização o tempo de CPU por quadro do OLED (envio bloqueante x DMA)
+#define BENCHMARK_OLED 0
+
 #define TEMPO_CONEXAO 2000
 #define TEMPO_MENSAGEM 2000
 #define TAM_FILA 16
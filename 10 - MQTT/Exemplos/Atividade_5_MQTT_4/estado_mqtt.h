@@ -16,7 +16,7 @@ extern struct render_area area;
 extern volatile uint32_t intervalo_ping_ms;
 
 void set_novo_intervalo_ping(uint32_t novo_intervalo);
-void mostrar_cor_rgb(uint8_t codigo);
+void mostrar_cor_rgb(uint32_t cor);
 extern bool publicar_online;
 
 
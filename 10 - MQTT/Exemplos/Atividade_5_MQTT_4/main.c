@@ -15,6 +15,7 @@
 #include "rgb_pwm_control.h"
 #include "configura_geral.h"
 #include "oled_utils.h"
+#include "oled_console.h"
 #include "ssd1306_i2c.h"
 #include "mqtt_lwip.h"
 #include "lwip/ip_addr.h"
@@ -23,13 +24,14 @@
 #include "estado_mqtt.h"
 #include <stdbool.h>
 #include "pico/time.h"
+#include "display.h"
 
 #define INTERVALO_MS 5000
 
 // Variável global e dinâmica para o tempo entre envios de PING
 volatile uint32_t intervalo_ping_ms = 5000;
 
-volatile uint8_t cor_rgb_pendente = 255;
+uint32_t cor_rgb_pendente = 0;
 absolute_time_t tempo_rgb_expiracao;
 bool exibir_cor_agendada = false;
 
@@ -77,7 +79,6 @@ int main() {
     if (exibir_cor_agendada && to_ms_since_boot(get_absolute_time()) >= to_ms_since_boot(tempo_rgb_expiracao)) {
         mostrar_cor_rgb(cor_rgb_pendente);
         exibir_cor_agendada = false;
-        cor_rgb_pendente = 255;
     }
 
     sleep_ms(50);  // intervalo entre ciclos
@@ -111,25 +112,16 @@ void verificar_fifo(void) {
         return;
     }
 
-    // --- Comando: controle do LED RGB ---
-    if (comando == 0xB1B1) {
-        switch (valor) {
-            case 0: set_rgb_pwm(0, 0, 0); break;                            // OFF
-            case 1: set_rgb_pwm(0, 0, PWM_STEP); break;                    // RED
-            case 2: set_rgb_pwm(0, PWM_STEP, 0); break;                    // GREEN
-            case 3: set_rgb_pwm(0, PWM_STEP, PWM_STEP); break;             // YELLOW
-            case 4: set_rgb_pwm(PWM_STEP, 0, 0); break;                    // BLUE
-            case 5: set_rgb_pwm(PWM_STEP, 0, PWM_STEP); break;             // MAGENTA
-            case 6: set_rgb_pwm(PWM_STEP, PWM_STEP, 0); break;             // CYAN
-            case 7: set_rgb_pwm(PWM_STEP, PWM_STEP, PWM_STEP); break;      // WHITE
-            default:
-                printf("[NÚCLEO 0] Código RGB inválido: %u\n", valor);
-                return;
-        }
-        cor_rgb_pendente = valor;
-        tempo_rgb_expiracao = make_timeout_time_ms(500);  // exibir 500 ms depois
+    // --- Comando: transição do LED RGB (valor = duração em ms) ---
+    if (comando == 0xB1B2) {
+        uint32_t palavra = multicore_fifo_pop_blocking();   // suavização << 24 | 0xRRGGBB
+        uint32_t cor = palavra & 0xFFFFFF;
+
+        rgb_transicao(cor, valor, (rgb_suavizacao_t)(palavra >> 24));
+        cor_rgb_pendente = cor;
+        tempo_rgb_expiracao = make_timeout_time_ms(valor);  // exibir ao fim da transição
         exibir_cor_agendada = true;
-        printf("[NÚCLEO 0] LED RGB atualizado. Código: %u\n", valor);
+        printf("[NÚCLEO 0] LED RGB em transição para #%06X (%u ms)\n", (unsigned)cor, valor);
         return;
     }
 
@@ -137,11 +129,7 @@ void verificar_fifo(void) {
     if (valor > 2 && comando != 0x9999) {
         snprintf(mensagem_str, sizeof(mensagem_str),
                  "Status inválido: %u (tentativa %u)", valor, comando);
-        ssd1306_draw_utf8_multiline(buffer_oled, 0, 0, "Status inválido.");
-        render_on_display(buffer_oled, &area);
-        sleep_ms(3000);
-        oled_clear(buffer_oled, &area);
-        render_on_display(buffer_oled, &area);
+        oled_console_escreve("Status inválido.");
         printf("%s\n", mensagem_str);
         return;
     }
@@ -149,11 +137,7 @@ void verificar_fifo(void) {
     // --- Mensagem válida para a fila circular ---
     MensagemWiFi msg = {.tentativa = comando, .status = valor};
     if (!fila_inserir(&fila_wifi, msg)) {
-        ssd1306_draw_utf8_multiline(buffer_oled, 0, 0, "Fila cheia. Descartado.");
-        render_on_display(buffer_oled, &area);
-        sleep_ms(3000);
-        oled_clear(buffer_oled, &area);
-        render_on_display(buffer_oled, &area);
+        oled_console_escreve("Fila cheia. Descartado.");
         printf("Fila cheia. Mensagem descartada.\n");
     }
 }
@@ -196,26 +180,29 @@ void enviar_ping_periodico(void) {
 }
 
 /**
- * @brief Inicializa o hardware local (USB, OLED, tela limpa).
+ * @brief Inicializa o hardware local (USB, OLED, console de mensagens).
  */
 void inicia_hardware(){
     stdio_init_all();
     setup_init_oled();
     espera_usb();
-    oled_clear(buffer_oled, &area);
-    render_on_display(buffer_oled, &area);
+#if BENCHMARK_OLED
+    benchmark_envio_oled(20);
+    benchmark_blit_oled(100);
+    benchmark_texto_oled(200);
+#endif
+#if SSD1306_EMU
+    teste_emulador_oled(false);
+#endif
+    // A partir daqui o OLED é um console: cada mensagem rola a tela uma linha
+    oled_console_init(buffer_oled, &area);
 }
 
 /**
  * @brief Mostra mensagem de inicialização e inicia o núcleo 1.
  */
 void inicia_core1(){
-    ssd1306_draw_utf8_multiline(buffer_oled, 0, 0, "Núcleo 0");
-    ssd1306_draw_utf8_multiline(buffer_oled, 0, 16, "Iniciando!");
-    render_on_display(buffer_oled, &area);
-    sleep_ms(3000);
-    oled_clear(buffer_oled, &area);
-    render_on_display(buffer_oled, &area);
+    oled_console_escreve("Núcleo 0\nIniciando!");
 
     printf(">> Núcleo 0 iniciado. Aguardando mensagens do núcleo 1...\n");
 
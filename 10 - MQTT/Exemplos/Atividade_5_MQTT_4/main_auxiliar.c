@@ -3,7 +3,7 @@
  * @brief Funções auxiliares do núcleo 0 no projeto multicore com Raspberry Pi Pico W.
  *
  * Este arquivo complementa a lógica do núcleo 0, com foco em:
- * - Visualização de mensagens no display OLED.
+ * - Visualização de mensagens no display OLED (console com rolagem, sem esperas).
  * - Interpretação dos dados vindos do núcleo 1 via FIFO.
  * - Controle do LED RGB com base no status da conexão Wi-Fi.
  * - Apresentação do endereço IP recebido.
@@ -14,6 +14,7 @@
 #include "rgb_pwm_control.h"
 #include "configura_geral.h"
 #include "oled_utils.h"
+#include "oled_console.h"
 #include "ssd1306_i2c.h"
 #include "mqtt_lwip.h"
 #include "lwip/ip_addr.h"
@@ -46,13 +47,12 @@ void tratar_mensagem(MensagemWiFi msg) {
     // ======= Retorno do PING =======
     if (msg.tentativa == 0x9999) {
         if (msg.status == 0) {
-            ssd1306_draw_utf8_multiline(buffer_oled, 0, 32, "ACK do PING OK");
+            oled_console_escreve("ACK do PING OK");
             set_rgb_pwm(0, 65535, 0); // verde
         } else {
-            ssd1306_draw_utf8_multiline(buffer_oled, 0, 32, "ACK do PING FALHOU");
+            oled_console_escreve("ACK do PING FALHOU");
             set_rgb_pwm(65535, 0, 0); // vermelho
         }
-        render_on_display(buffer_oled, &area);
         return;
     }
 
@@ -79,11 +79,7 @@ void tratar_mensagem(MensagemWiFi msg) {
     char linha_status[32];
     snprintf(linha_status, sizeof(linha_status), "Status do Wi-Fi : %s", descricao);
 
-    ssd1306_draw_utf8_multiline(buffer_oled, 0, 0, linha_status);
-    render_on_display(buffer_oled, &area);
-    sleep_ms(3000);
-    oled_clear(buffer_oled, &area);
-    render_on_display(buffer_oled, &area);
+    oled_console_escreve(linha_status);
 
     printf("[NÚCLEO 0] Status: %s (%s)\n", descricao, msg.tentativa > 0 ? descricao : "evento");
 }
@@ -105,9 +101,7 @@ void tratar_ip_binario(uint32_t ip_bin) {
 
     snprintf(ip_str, sizeof(ip_str), "%d.%d.%d.%d", ip[0], ip[1], ip[2], ip[3]);
 
-    oled_clear(buffer_oled, &area);
-    ssd1306_draw_utf8_string(buffer_oled, 0, 0, ip_str);
-    render_on_display(buffer_oled, &area);
+    oled_console_escreve(ip_str);
 
     printf("[NÚCLEO 0] Endereço IP: %s\n", ip_str);
     ultimo_ip_bin = ip_bin;
@@ -116,14 +110,17 @@ void tratar_ip_binario(uint32_t ip_bin) {
 /**
  * @brief Exibe o status da conexão MQTT no OLED e no terminal.
  *
- * Atualiza a linha 16 do display com a palavra "MQTT: <status>".
+ * Acrescenta ao console do display a linha "MQTT: <status>".
  */
 void exibir_status_mqtt(const char *texto) {
-    ssd1306_draw_utf8_string(buffer_oled, 0, 16, "MQTT: ");
-    ssd1306_draw_utf8_string(buffer_oled, 40, 16, texto);
-    render_on_display(buffer_oled, &area);
+    oled_console_printf("MQTT: %s", texto);
 
     printf("[MQTT] %s\n", texto);
+#if BENCHMARK_OLED
+    printf("[OLED] Quadro: %lu bytes em %lu janela(s)\n",
+           (unsigned long)ssd1306_get_stats()->last_frame_bytes,
+           (unsigned long)ssd1306_get_stats()->last_frame_windows);
+#endif
 }
 
 /**
@@ -132,19 +129,13 @@ void exibir_status_mqtt(const char *texto) {
  * Recebe um novo valor de tempo (em milissegundos) e:
  * - Valida se está entre 1000 e 60000 ms.
  * - Atualiza a variável global `intervalo_ping_ms`.
- * - Exibe o novo valor abaixo da confirmação do ACK.
+ * - Exibe o novo valor no console do display.
  */
 void set_novo_intervalo_ping(uint32_t novo_intervalo) {
     if (novo_intervalo >= 1000 && novo_intervalo <= 60000) {
         intervalo_ping_ms = novo_intervalo;
 
-        char buffer_msg[32];
-        snprintf(buffer_msg, sizeof(buffer_msg), "Intervalo: %u ms", novo_intervalo);
-
-        // Exibe abaixo da linha do ACK (linha 32 → y = 42 px)
-        ssd1306_clear_area(buffer_oled, 0, 40, 127, 50);
-        ssd1306_draw_utf8_multiline(buffer_oled, 0, 42, buffer_msg);
-        render_on_display(buffer_oled, &area);
+        oled_console_printf("Intervalo: %u ms", novo_intervalo);
 
         printf("[INFO] Intervalo atualizado para %u ms\n", novo_intervalo);
     } else {
@@ -156,39 +147,21 @@ void set_novo_intervalo_ping(uint32_t novo_intervalo) {
 /**
  * @brief Exibe no OLED e no terminal a cor RGB ativada.
  *
- * Recebe o código RGB (0 a 7), interpreta a cor correspondente,
- * exibe no display (linha inferior) e imprime no terminal.
- */
-/**
- * @brief Exibe no OLED e no terminal a cor RGB ativada.
- *
- * Recebe o código RGB (0 a 7), interpreta a cor correspondente,
- * exibe no display (linha inferior) e imprime no terminal.
+ * Recebe a cor (0xRRGGBB); usa o nome quando é uma das cores nomeadas e o
+ * valor hexadecimal nos demais casos. Acrescenta uma linha ao console do display
+ * e imprime no terminal.
  */
-void mostrar_cor_rgb(uint8_t codigo) {
-    const char *nome_cor = "RGB: ---";
-
-    switch (codigo) {
-        case 0: nome_cor = "RGB: APAGADO";   break;
-        case 1: nome_cor = "RGB: AZUL";      break;
-        case 2: nome_cor = "RGB: VERDE";     break;
-        case 3: nome_cor = "RGB: CIANO";     break;
-        case 4: nome_cor = "RGB: VERMELHO";  break;
-        case 5: nome_cor = "RGB: MAGENTA";   break;
-        case 6: nome_cor = "RGB: AMARELO";   break;
-        case 7: nome_cor = "RGB: BRANCO";    break;
-        default:
-            printf("[NÚCLEO 0] Código RGB inválido: %u\n", codigo);
-            return;
+void mostrar_cor_rgb(uint32_t cor) {
+    char nome_cor[20];
+    const char *nome = rgb_nome_da_cor(cor);
+
+    if (nome) {
+        snprintf(nome_cor, sizeof(nome_cor), "RGB: %s", nome);
+    } else {
+        snprintf(nome_cor, sizeof(nome_cor), "RGB: #%06X", (unsigned)cor);
     }
 
     printf("[NÚCLEO 0] Cor exibida no OLED: %s\n", nome_cor);
 
-    // Atualiza a linha inferior do OLED
-    ssd1306_clear_area(buffer_oled, 0, 54, 127, 63);  // limpa linha inferior
-    ssd1306_draw_utf8_multiline(buffer_oled, 0, 56, nome_cor);
-    render_on_display(buffer_oled, &area);
-    sleep_ms(3500);
-    ssd1306_clear_area(buffer_oled, 0, 54, 127, 63);  // limpa linha inferior
-    render_on_display(buffer_oled, &area);
+    oled_console_escreve(nome_cor);
 }
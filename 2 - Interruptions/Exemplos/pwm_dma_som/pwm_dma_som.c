@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "som_dma.h"
+
+#define PWM_GPIO 21               // Buzzer da BitDogLab
+#define PWM_FREQ_HZ 1000          // Frequência do bipe em Hz (1 kHz)
+
+// O exemplo isr_pwm conta o bipe na interrupção de wrap do PWM (1000 IRQs por segundo, com
+// printf dentro do handler). Aqui o mesmo bipe é uma sequência de notas tocada pelo motor de
+// som_dma.c: o DMA escreve as amostras no PWM e a CPU só sintetiza blocos no laço principal.
+
+#define PCM_TAXA_HZ 8000
+#define PCM_AMOSTRAS 1600         // 200 ms
+
+// Bipe de 100 ms a cada segundo, como em isr_pwm
+static const som_nota_t bipe[] = {
+    { PWM_FREQ_HZ, 100 },
+    { 0, 900 },
+};
+
+// Melodia de abertura (dó, mi, sol, dó agudo)
+static const som_nota_t abertura[] = {
+    { 523, 150 }, { 659, 150 }, { 784, 150 }, { 1047, 400 },
+};
+
+static const som_envelope_t env_bipe = { 2, 10, 200, 10 };
+static const som_envelope_t env_melodia = { 10, 60, 140, 80 };
+
+// Amostra PCM de um "clique": ruído com decaimento exponencial
+static uint8_t clique[PCM_AMOSTRAS];
+
+static void gera_clique(void) {
+    uint32_t semente = 12345;
+    int32_t amplitude = 127 << 8;
+    for (int i = 0; i < PCM_AMOSTRAS; i++) {
+        semente = semente * 1664525u + 1013904223u;
+        int32_t ruido = (int8_t)(semente >> 24);
+        clique[i] = (uint8_t)(128 + ruido * (amplitude >> 8) / 128);
+        amplitude -= amplitude / 200;
+    }
+}
+
+int main() {
+    stdio_init_all();
+    sleep_ms(2000);
+    printf("🌀 Som por DMA no GPIO21 (Buzzer BitDogLab)\n");
+
+    gera_clique();
+    som_init(PWM_GPIO);
+
+    som_toca_sequencia(0, bipe, 2, SOM_QUADRADA, &env_bipe, 255, true);
+    som_toca_sequencia(1, abertura, 4, SOM_TRIANGULAR, &env_melodia, 200, false);
+
+    absolute_time_t proximo_relatorio = make_timeout_time_ms(5000);
+    som_estatisticas_t anterior = som_estatisticas();
+    uint64_t t_anterior = time_us_64();
+
+    while (true) {
+        // Tarefa de menor prioridade: reabastece o anel de amostras
+        som_atualiza();
+
+        if (time_reached(proximo_relatorio)) {
+            proximo_relatorio = make_timeout_time_ms(5000);
+
+            // Custo de CPU da reprodução no intervalo: ciclos em som_atualiza() / ciclos totais
+            som_estatisticas_t agora = som_estatisticas();
+            uint64_t t_agora = time_us_64();
+            uint32_t ciclos = agora.ciclos - anterior.ciclos;
+            uint32_t amostras = agora.amostras - anterior.amostras;
+            float total = (t_agora - t_anterior) * (clock_get_hz(clk_sys) / 1e6f);
+
+            printf("🔊 %lu amostras em %lu blocos: %.1f ciclos/amostra, CPU %.2f%%\n",
+                   (unsigned long)amostras, (unsigned long)(agora.blocos - anterior.blocos),
+                   amostras ? (float)ciclos / amostras : 0.0f, 100.0f * ciclos / total);
+
+            anterior = agora;
+            t_anterior = t_agora;
+
+            if (!som_tocando(1)) {
+                som_toca_pcm(1, clique, PCM_AMOSTRAS, PCM_TAXA_HZ, 255);
+            }
+        }
+
+        sleep_ms(5);
+    }
+
+    return 0;
+}
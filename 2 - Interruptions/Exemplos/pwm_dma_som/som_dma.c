@@ -0,0 +1,305 @@
+#include <math.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+#include "som_dma.h"
+
+#define SOM_WRAP 255
+#define SOM_AMOSTRAS (SOM_BLOCOS * SOM_BLOCO)
+#define SOM_SILENCIO 128
+#define ENV_MAX (1u << 24)    // Nível máximo do envelope (ponto fixo)
+
+typedef enum { ENV_ATAQUE, ENV_DECAIMENTO, ENV_SUSTENTACAO, ENV_LIBERACAO } som_estado_env_t;
+
+typedef struct {
+    bool ativa;
+    bool pcm;
+    uint8_t volume;
+
+    // Sequência de notas
+    const som_nota_t *notas;
+    uint n_notas, nota;
+    bool repete;
+    som_forma_t forma;
+    som_envelope_t env;
+    uint32_t fase, passo_fase;          // Acumulador de fase (32 bits = um período)
+    uint32_t t, amostras_nota, amostras_liberacao;
+    som_estado_env_t estado;
+    uint32_t nivel, inc_ataque, inc_decaimento, nivel_sustentacao, dec_liberacao;
+
+    // PCM
+    const uint8_t *dados;
+    uint32_t n_dados;
+    uint32_t pos, passo_pos;            // Posição em 16.16
+} som_voz_t;
+
+static uint16_t anel[SOM_AMOSTRAS];
+static const uint16_t *inicio_anel = anel;   // Lido pelo canal de controle a cada volta
+static int dma_dados = -1;
+static int dma_controle = -1;
+static uint proximo_bloco = 0;               // Mais antigo já tocado (próximo a sintetizar)
+static uint32_t taxa_real = SOM_TAXA_HZ;
+
+static som_voz_t vozes[SOM_VOZES];
+static int8_t seno[256];
+static som_estatisticas_t estatisticas;
+
+static const som_envelope_t envelope_padrao = { 2, 0, 255, 5 };
+
+static uint32_t ms_para_amostras(uint32_t ms) {
+    return ms * taxa_real / 1000;
+}
+
+// Prepara a voz para a nota atual da sequência
+static void inicia_nota(som_voz_t *v) {
+    const som_nota_t *n = &v->notas[v->nota];
+
+    v->passo_fase = (uint32_t)(((uint64_t)n->freq_hz << 32) / taxa_real);
+    v->t = 0;
+    v->amostras_nota = ms_para_amostras(n->dur_ms);
+    if (v->amostras_nota == 0) {
+        v->amostras_nota = 1;
+    }
+
+    uint32_t ataque = ms_para_amostras(v->env.ataque_ms);
+    uint32_t decaimento = ms_para_amostras(v->env.decaimento_ms);
+    v->amostras_liberacao = MIN(ms_para_amostras(v->env.liberacao_ms), v->amostras_nota);
+    v->nivel_sustentacao = (uint32_t)v->env.sustentacao * (ENV_MAX / 255);
+    v->inc_ataque = ataque ? ENV_MAX / ataque : ENV_MAX;
+    v->inc_decaimento = decaimento ? (ENV_MAX - v->nivel_sustentacao) / decaimento + 1 : ENV_MAX;
+    v->nivel = 0;
+    v->estado = ENV_ATAQUE;
+}
+
+// Avança o envelope uma amostra e retorna o nível de 0 a 256
+static uint32_t envelope(som_voz_t *v) {
+    if (v->t == v->amostras_nota - v->amostras_liberacao) {
+        v->estado = ENV_LIBERACAO;
+        v->dec_liberacao = v->amostras_liberacao ? v->nivel / v->amostras_liberacao + 1 : v->nivel;
+    }
+
+    switch (v->estado) {
+        case ENV_ATAQUE:
+            v->nivel += v->inc_ataque;
+            if (v->nivel >= ENV_MAX) {
+                v->nivel = ENV_MAX;
+                v->estado = ENV_DECAIMENTO;
+            }
+            break;
+        case ENV_DECAIMENTO:
+            if (v->nivel <= v->nivel_sustentacao + v->inc_decaimento) {
+                v->nivel = v->nivel_sustentacao;
+                v->estado = ENV_SUSTENTACAO;
+            } else {
+                v->nivel -= v->inc_decaimento;
+            }
+            break;
+        case ENV_SUSTENTACAO:
+            break;
+        case ENV_LIBERACAO:
+            v->nivel = v->nivel > v->dec_liberacao ? v->nivel - v->dec_liberacao : 0;
+            break;
+    }
+    return v->nivel >> 16;
+}
+
+static int32_t onda(const som_voz_t *v) {
+    uint8_t x = v->fase >> 24;
+    switch (v->forma) {
+        case SOM_QUADRADA:   return (v->fase & 0x80000000u) ? -127 : 127;
+        case SOM_TRIANGULAR: return (x < 128) ? x * 2 - 127 : (255 - x) * 2 - 127;
+        default:             return seno[x];
+    }
+}
+
+// Próxima amostra da voz (-127 a 127)
+static int32_t voz_amostra(som_voz_t *v) {
+    if (!v->ativa) {
+        return 0;
+    }
+
+    if (v->pcm) {
+        uint32_t i = v->pos >> 16;
+        if (i >= v->n_dados) {
+            v->ativa = false;
+            return 0;
+        }
+        v->pos += v->passo_pos;
+        return ((int32_t)v->dados[i] - 128) * v->volume / 255;
+    }
+
+    int32_t s = 0;
+    uint32_t nivel = envelope(v);
+    if (v->passo_fase) {
+        s = (onda(v) * (int32_t)nivel >> 8) * v->volume / 255;
+        v->fase += v->passo_fase;
+    }
+
+    if (++v->t >= v->amostras_nota) {
+        if (++v->nota >= v->n_notas) {
+            if (!v->repete) {
+                v->ativa = false;
+                return s;
+            }
+            v->nota = 0;
+        }
+        inicia_nota(v);
+    }
+    return s;
+}
+
+// Preenche um bloco com a mistura das vozes (soma saturada) em níveis de PWM
+static void sintetiza_bloco(uint16_t *bloco) {
+    for (uint i = 0; i < SOM_BLOCO; i++) {
+        int32_t s = 0;
+        for (uint k = 0; k < SOM_VOZES; k++) {
+            s += voz_amostra(&vozes[k]);
+        }
+        s = s > 127 ? 127 : s < -128 ? -128 : s;
+        bloco[i] = (uint16_t)(SOM_SILENCIO + s);
+    }
+}
+
+/**
+ * @brief Configura o PWM do buzzer como conversor de 8 bits e inicia o DMA em anel.
+ *
+ * Toma o SysTick (contagem de ciclos para som_estatisticas()).
+ */
+void som_init(uint gpio) {
+    for (int i = 0; i < 256; i++) {
+        seno[i] = (int8_t)lroundf(127.0f * sinf(i * 2.0f * (float)M_PI / 256.0f));
+    }
+    memset(vozes, 0, sizeof(vozes));
+
+    // PWM: um período por amostra; o divisor é 8.4, então a taxa real é recalculada
+    gpio_set_function(gpio, GPIO_FUNC_PWM);
+    uint slice = pwm_gpio_to_slice_num(gpio);
+    uint chan = pwm_gpio_to_channel(gpio);
+    uint32_t div16 = (uint32_t)((clock_get_hz(clk_sys) * 16ull) / ((SOM_WRAP + 1ull) * SOM_TAXA_HZ));
+    taxa_real = (uint32_t)((clock_get_hz(clk_sys) * 16ull) / ((SOM_WRAP + 1ull) * div16));
+
+    pwm_config cfg = pwm_get_default_config();
+    pwm_config_set_clkdiv(&cfg, div16 / 16.0f);
+    pwm_config_set_wrap(&cfg, SOM_WRAP);
+    pwm_init(slice, &cfg, false);
+
+    for (uint i = 0; i < SOM_AMOSTRAS; i++) {
+        anel[i] = SOM_SILENCIO;
+    }
+    proximo_bloco = 0;
+
+    dma_dados = dma_claim_unused_channel(true);
+    dma_controle = dma_claim_unused_channel(true);
+
+    // Dados: uma amostra por wrap, todo o anel; ao fim passa ao controle
+    dma_channel_config dc = dma_channel_get_default_config(dma_dados);
+    channel_config_set_transfer_data_size(&dc, DMA_SIZE_16);
+    channel_config_set_read_increment(&dc, true);
+    channel_config_set_write_increment(&dc, false);
+    channel_config_set_dreq(&dc, DREQ_PWM_WRAP0 + slice);
+    channel_config_set_chain_to(&dc, dma_controle);
+
+    // Escrita de 16 bits é replicada nas duas metades de CC (o canal A do slice recebe o mesmo)
+    uintptr_t cc = (chan == PWM_CHAN_A) ? (uintptr_t)&pwm_hw->slice[slice].cc
+                                        : (uintptr_t)&pwm_hw->slice[slice].cc + 2;
+    dma_channel_configure(dma_dados, &dc, (void *)cc, anel, SOM_AMOSTRAS, false);
+
+    // Controle: devolve o endereço do anel ao READ_ADDR com gatilho do canal de dados
+    dma_channel_config cc_cfg = dma_channel_get_default_config(dma_controle);
+    channel_config_set_transfer_data_size(&cc_cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&cc_cfg, false);
+    channel_config_set_write_increment(&cc_cfg, false);
+    dma_channel_configure(dma_controle, &cc_cfg, &dma_hw->ch[dma_dados].al3_read_addr_trig,
+                          &inicio_anel, 1, false);
+
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;   // Habilitado, clock do processador
+
+    dma_channel_start(dma_dados);
+    pwm_set_enabled(slice, true);
+}
+
+/**
+ * @brief Toca uma sequência de notas em uma voz, substituindo o que ela tocava.
+ *
+ * @param envelope  ADSR de cada nota (NULL = ataque de 2 ms e liberação de 5 ms)
+ * @param volume    0 a 255
+ * @param repete    Recomeça a sequência ao terminar
+ */
+void som_toca_sequencia(uint voz, const som_nota_t *notas, uint n, som_forma_t forma,
+                        const som_envelope_t *envelope, uint8_t volume, bool repete) {
+    if (voz >= SOM_VOZES || n == 0) {
+        return;
+    }
+
+    som_voz_t *v = &vozes[voz];
+    memset(v, 0, sizeof(*v));
+    v->notas = notas;
+    v->n_notas = n;
+    v->forma = forma;
+    v->env = envelope ? *envelope : envelope_padrao;
+    v->volume = volume;
+    v->repete = repete;
+    inicia_nota(v);
+    v->ativa = true;
+}
+
+/**
+ * @brief Toca amostras PCM de 8 bits sem sinal (128 = silêncio) gravadas a `taxa_hz`.
+ */
+void som_toca_pcm(uint voz, const uint8_t *pcm, uint32_t n, uint32_t taxa_hz, uint8_t volume) {
+    if (voz >= SOM_VOZES || n == 0) {
+        return;
+    }
+
+    som_voz_t *v = &vozes[voz];
+    memset(v, 0, sizeof(*v));
+    v->pcm = true;
+    v->dados = pcm;
+    v->n_dados = n;
+    v->passo_pos = (uint32_t)(((uint64_t)taxa_hz << 16) / taxa_real);
+    v->volume = volume;
+    v->ativa = true;
+}
+
+void som_para(uint voz) {
+    if (voz < SOM_VOZES) {
+        vozes[voz].ativa = false;
+    }
+}
+
+bool som_tocando(uint voz) {
+    return voz < SOM_VOZES && vozes[voz].ativa;
+}
+
+/**
+ * @brief Sintetiza os blocos que o DMA já tocou. Chamar a cada poucos milissegundos
+ *        (no máximo (SOM_BLOCOS - 1) blocos de intervalo, ~34 ms).
+ *
+ * O bloco que contém a próxima amostra do DMA é o que está tocando; os anteriores a
+ * ele (desde o último preenchido) estão livres.
+ */
+void som_atualiza(void) {
+    uint32_t inicio = systick_hw->cvr;
+
+    uint32_t lido = (dma_hw->ch[dma_dados].read_addr - (uintptr_t)anel) / sizeof(anel[0]);
+    uint atual = (lido / SOM_BLOCO) % SOM_BLOCOS;
+
+    while (proximo_bloco != atual) {
+        sintetiza_bloco(&anel[proximo_bloco * SOM_BLOCO]);
+        proximo_bloco = (proximo_bloco + 1) % SOM_BLOCOS;
+        estatisticas.blocos++;
+        estatisticas.amostras += SOM_BLOCO;
+    }
+
+    estatisticas.ciclos += (inicio - systick_hw->cvr) & 0x00FFFFFF;
+}
+
+// Contadores acumulados desde som_init() (para medir o custo de CPU da reprodução)
+som_estatisticas_t som_estatisticas(void) {
+    return estatisticas;
+}
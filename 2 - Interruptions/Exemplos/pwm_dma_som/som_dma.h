@@ -0,0 +1,57 @@
+#ifndef SOM_DMA_H
+#define SOM_DMA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/types.h"
+
+// Motor de som para o buzzer: amostras de 8 bits tocadas pelo PWM (nível = amostra, wrap 255).
+// Um canal DMA ritmado pelo DREQ de wrap do próprio slice escreve uma amostra por período
+// no registrador de comparação; a CPU não é interrompida durante a reprodução.
+//
+// As amostras ficam em um anel de SOM_BLOCOS blocos. Ao fim do anel o canal de dados
+// encadeia um canal de controle que o rearma no início. som_atualiza(), chamada pela
+// tarefa de menor prioridade (laço principal), sintetiza os blocos que o DMA já tocou:
+// duas vozes (tons com envelope ou PCM de 8 bits) somadas com saturação.
+
+#define SOM_TAXA_HZ 22050     // Amostras por segundo (= frequência do PWM)
+#define SOM_BLOCO 256         // Amostras por bloco (~11,6 ms)
+#define SOM_BLOCOS 4          // Blocos no anel: som_atualiza() pode atrasar até ~34 ms
+#define SOM_VOZES 2
+
+typedef enum {
+    SOM_QUADRADA,
+    SOM_TRIANGULAR,
+    SOM_SENOIDE
+} som_forma_t;
+
+// Uma nota da sequência; freq_hz = 0 é pausa
+typedef struct {
+    uint16_t freq_hz;
+    uint16_t dur_ms;
+} som_nota_t;
+
+// Envelope ADSR aplicado a cada nota; a liberação ocupa o fim da duração da nota
+typedef struct {
+    uint16_t ataque_ms;
+    uint16_t decaimento_ms;
+    uint8_t sustentacao;      // Nível de sustentação (0 a 255)
+    uint16_t liberacao_ms;
+} som_envelope_t;
+
+typedef struct {
+    uint32_t ciclos;          // Ciclos de clk_sys gastos em som_atualiza()
+    uint32_t amostras;        // Amostras sintetizadas
+    uint32_t blocos;          // Blocos sintetizados
+} som_estatisticas_t;
+
+void som_init(uint gpio);
+void som_toca_sequencia(uint voz, const som_nota_t *notas, uint n, som_forma_t forma,
+                        const som_envelope_t *envelope, uint8_t volume, bool repete);
+void som_toca_pcm(uint voz, const uint8_t *pcm, uint32_t n, uint32_t taxa_hz, uint8_t volume);
+void som_para(uint voz);
+bool som_tocando(uint voz);
+void som_atualiza(void);
+som_estatisticas_t som_estatisticas(void);
+
+#endif
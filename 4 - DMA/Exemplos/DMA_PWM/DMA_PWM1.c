@@ -2,84 +2,165 @@
 #include "pico/stdlib.h"
 #include "hardware/pwm.h"
 #include "hardware/dma.h"
-#include "hardware/irq.h"
+#include "hardware/clocks.h"
+
+// Gerador de formas de onda PWM por DMA, sem CPU depois de iniciado.
+//
+// Cada onda guarda só os níveis únicos de um período (a respiração tem 512). A repetição
+// de cada nível não vem de dados duplicados: o canal DMA de dados é ritmado pelo wrap de
+// um slice PWM sem pino (o "ritmo"), que dispara passos_por_s vezes por segundo. Ao fim
+// da tabela o canal de dados encadeia um canal de controle, que reescreve o endereço de
+// leitura do canal de dados (registrador com gatilho) e o reinicia: a onda se repete
+// indefinidamente, sem interrupção.
+//
+// O temporizador de ritmo do DMA (dma_timer) não desce abaixo de clk_sys / 65535
+// (~1,9 kHz a 125 MHz), lento demais para uma respiração de segundos; o wrap de um slice
+// PWM com divisor 1..255 e wrap de 16 bits chega a ~7,5 Hz.
+//
+// Escritas de 16 bits em registradores do RP2040 são replicadas nas duas metades: os dois
+// pinos (A e B) de um slice de saída recebem o mesmo nível. Use uma onda por slice.
 
-#define LED_PIN 12
 #define PWM_WRAP 255
 #define FADE_STEPS 256
-#define REPEAT_FACTOR 45  // Repetições por valor
-#define FADE_LEN (FADE_STEPS * 2 * REPEAT_FACTOR)  // Tamanho final: 512 * 45 = 23040
-
-uint16_t fade_table[FADE_LEN];
-
-volatile bool dma_reiniciar = false;
-
-void dma_irq_handler() {
-    dma_hw->ints0 = 1u << 0;  // Limpa interrupção do canal 0
-    dma_reiniciar = true;
+#define FADE_LEN (FADE_STEPS * 2)   // Níveis únicos: subida + descida
+
+// Tamanho da tabela antiga, com cada nível repetido 45 vezes (só para o relatório)
+#define REPEAT_FACTOR_ANTIGO 45
+
+// Pinos da BitDogLab
+#define LED_AZUL_PIN 12    // Slice 6 A
+#define LED_VERDE_PIN 11   // Slice 5 B
+#define BUZZER_PIN 21      // Slice 2 B
+
+typedef struct {
+    uint gpio;
+    const uint16_t *niveis;     // Níveis de um período
+    uint16_t n_niveis;
+    float passos_por_s;         // Níveis aplicados por segundo
+    float clkdiv_saida;         // Divisor do PWM da saída (frequência da portadora)
+    uint slice_ritmo;           // Slice sem pino que gera o DREQ
+
+    // Preenchidos por onda_inicia()
+    int dma_dados;
+    int dma_controle;
+    const uint16_t *endereco;   // Lido pelo canal de controle a cada volta
+} onda_pwm_t;
+
+static uint16_t respiracao[FADE_LEN];
+static uint16_t pulso_buzzer[FADE_LEN / 4];
+
+// Subida 0..255 seguida de descida 255..0, como a tabela original sem as repetições
+static void gera_respiracao(uint16_t *tabela) {
+    for (int i = 0; i < FADE_STEPS; i++) {
+        tabela[i] = i;
+        tabela[FADE_STEPS + i] = PWM_WRAP - i;
+    }
 }
 
-int main() {
-    stdio_init_all();
-    sleep_ms(2000);
-    printf("🚀 Iniciando PWM com DMA (Efeito de Respiração Suave)\n");
+// Envelope de volume do buzzer: sobe até 50% de ciclo (volume máximo) e desce
+static void gera_pulso(uint16_t *tabela, int n) {
+    for (int i = 0; i < n / 2; i++) {
+        tabela[i] = (uint16_t)(i * (PWM_WRAP + 1) / n);
+        tabela[n - 1 - i] = tabela[i];
+    }
+}
 
-    // Preenche a tabela com valores repetidos
-    for (int i = 0; i < FADE_STEPS; i++) {
-        uint16_t val_up = i;
-        uint16_t val_down = PWM_WRAP - i;
+// Ajusta o slice de ritmo para dar `passos_por_s` wraps por segundo
+static void configura_ritmo(uint slice, float passos_por_s) {
+    float ciclos = clock_get_hz(clk_sys) / passos_por_s;
+    float div = ciclos / 65536.0f;
+    div = div < 1.0f ? 1.0f : div > 255.0f ? 255.0f : (float)(int)(div + 1.0f);
 
-        for (int j = 0; j < REPEAT_FACTOR; j++) {
-            fade_table[i * REPEAT_FACTOR + j] = val_up;
-            fade_table[(FADE_STEPS + i) * REPEAT_FACTOR + j] = val_down;
-        }
-    }
+    pwm_set_clkdiv(slice, div);
+    pwm_set_wrap(slice, (uint16_t)(ciclos / div) - 1);
+    pwm_set_enabled(slice, true);
+}
 
-    // Configura GPIO como PWM
-    gpio_set_function(LED_PIN, GPIO_FUNC_PWM);
-    uint slice = pwm_gpio_to_slice_num(LED_PIN);
-    uint chan = pwm_gpio_to_channel(LED_PIN);
+static void onda_inicia(onda_pwm_t *o) {
+    // Saída
+    gpio_set_function(o->gpio, GPIO_FUNC_PWM);
+    uint slice = pwm_gpio_to_slice_num(o->gpio);
+    uint chan = pwm_gpio_to_channel(o->gpio);
 
     pwm_set_wrap(slice, PWM_WRAP);
-    pwm_set_clkdiv(slice, 64.0f); // Frequência ~7.6kHz
+    pwm_set_clkdiv(slice, o->clkdiv_saida);
     pwm_set_enabled(slice, true);
 
-    // Configura DMA
-    int dma_chan = dma_claim_unused_channel(true);
-    dma_channel_config cfg = dma_channel_get_default_config(dma_chan);
+    configura_ritmo(o->slice_ritmo, o->passos_por_s);
+
+    o->endereco = o->niveis;
+    o->dma_dados = dma_claim_unused_channel(true);
+    o->dma_controle = dma_claim_unused_channel(true);
 
+    // Dados: um nível por wrap do slice de ritmo; ao terminar, passa ao controle
+    dma_channel_config cfg = dma_channel_get_default_config(o->dma_dados);
     channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
     channel_config_set_read_increment(&cfg, true);
     channel_config_set_write_increment(&cfg, false);
-    channel_config_set_dreq(&cfg, DREQ_PWM_WRAP0 + slice);
+    channel_config_set_dreq(&cfg, DREQ_PWM_WRAP0 + o->slice_ritmo);
+    channel_config_set_chain_to(&cfg, o->dma_controle);
 
-    uint32_t pwm_dest_reg = (chan == PWM_CHAN_A)
+    uintptr_t pwm_dest_reg = (chan == PWM_CHAN_A)
         ? (uintptr_t)&pwm_hw->slice[slice].cc
         : (uintptr_t)&pwm_hw->slice[slice].cc + 2;
 
     dma_channel_configure(
-        dma_chan, &cfg,
+        o->dma_dados, &cfg,
         (void *)pwm_dest_reg,
-        fade_table,
-        FADE_LEN,
-        false // Não inicia ainda
+        o->niveis,
+        o->n_niveis,   // Recarregado a cada disparo
+        false
     );
 
-    // IRQ para reiniciar DMA
-    irq_set_exclusive_handler(DMA_IRQ_0, dma_irq_handler);
-    irq_set_enabled(DMA_IRQ_0, true);
-    dma_channel_set_irq0_enabled(dma_chan, true);
+    // Controle: uma palavra (o endereço da tabela) no READ_ADDR com gatilho do canal de dados
+    dma_channel_config ctrl = dma_channel_get_default_config(o->dma_controle);
+    channel_config_set_transfer_data_size(&ctrl, DMA_SIZE_32);
+    channel_config_set_read_increment(&ctrl, false);
+    channel_config_set_write_increment(&ctrl, false);
 
-    dma_channel_start(dma_chan);
+    dma_channel_configure(
+        o->dma_controle, &ctrl,
+        &dma_hw->ch[o->dma_dados].al3_read_addr_trig,
+        &o->endereco,
+        1,
+        false
+    );
 
-    while (true) {
-        if (dma_reiniciar) {
-            dma_reiniciar = false;
+    dma_channel_start(o->dma_controle);
+}
+
+int main() {
+    stdio_init_all();
+    sleep_ms(2000);
+    printf("🚀 Iniciando PWM com DMA (Efeito de Respiração Suave)\n");
 
-            dma_channel_set_read_addr(dma_chan, fade_table, false);
-            dma_channel_set_trans_count(dma_chan, FADE_LEN, true);
-        }
+    gera_respiracao(respiracao);
+    gera_pulso(pulso_buzzer, FADE_LEN / 4);
+
+    // Slices 0, 1, 3 e 4 não têm pino usado aqui: servem de ritmo
+    static onda_pwm_t ondas[] = {
+        // Respiração de ~3 s, como a tabela antiga (23040 wraps a ~7,6 kHz)
+        { LED_AZUL_PIN,  respiracao, FADE_LEN, FADE_LEN / 3.02f, 64.0f, 0 },
+        // Verde no dobro do ritmo
+        { LED_VERDE_PIN, respiracao, FADE_LEN, FADE_LEN / 1.51f, 64.0f, 1 },
+        // Buzzer: portadora de ~2 kHz com volume pulsando duas vezes por segundo
+        { BUZZER_PIN, pulso_buzzer, FADE_LEN / 4, FADE_LEN / 4 * 2.0f, 244.0f, 3 },
+    };
+    const int n_ondas = sizeof(ondas) / sizeof(ondas[0]);
+
+    for (int i = 0; i < n_ondas; i++) {
+        onda_inicia(&ondas[i]);
+    }
+
+    printf("📊 RAM: tabelas %u B (respiração %u B, buzzer %u B) + %u B de estado para %d ondas\n",
+           (unsigned)(sizeof(respiracao) + sizeof(pulso_buzzer)),
+           (unsigned)sizeof(respiracao), (unsigned)sizeof(pulso_buzzer),
+           (unsigned)sizeof(ondas), n_ondas);
+    printf("   Antes: %u B para um único LED (cada nível repetido %d vezes)\n",
+           (unsigned)(FADE_LEN * REPEAT_FACTOR_ANTIGO * sizeof(uint16_t)), REPEAT_FACTOR_ANTIGO);
 
+    // Tudo roda no DMA: a CPU fica livre
+    while (true) {
         tight_loop_contents();
     }
 
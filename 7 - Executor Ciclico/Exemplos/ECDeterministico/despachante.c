@@ -0,0 +1,128 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: despachante.c
+ *  Projeto: ECDeterministico
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementa o despachante por slots (ver despachante.h).
+ *      A fila entre a interrupção do timer e o laço principal
+ *      tem um único produtor (a interrupção) e um único
+ *      consumidor (o laço), então índices voláteis bastam,
+ *      sem desabilitar interrupções.
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/timer.h"
+#include "despachante.h"
+
+typedef struct {
+    uint8_t slot;
+    uint32_t abertura_us;       // time_us_32() na abertura do slot
+} liberacao_t;
+
+static const despachante_slot_t *slots;
+static uint32_t num_slots;
+static uint32_t duracao_slot_us;
+static despachante_estat_t estat[DESPACHANTE_MAX_SLOTS];
+
+static repeating_timer_t timer;
+static volatile uint32_t slot_atual = 0;
+static liberacao_t fila[DESPACHANTE_FILA];
+static volatile uint32_t fila_escrita = 0;   // Só a interrupção escreve
+static volatile uint32_t fila_leitura = 0;   // Só o laço principal escreve
+static volatile uint32_t liberacoes_perdidas = 0;
+
+// Abre o slot seguinte: só registra a liberação, a tarefa roda no laço principal
+static bool abre_slot(repeating_timer_t *rt) {
+    uint32_t agora = time_us_32();
+    uint32_t slot = slot_atual;
+
+    if (fila_escrita - fila_leitura < DESPACHANTE_FILA) {
+        fila[fila_escrita % DESPACHANTE_FILA] = (liberacao_t){ (uint8_t)slot, agora };
+        fila_escrita++;
+    } else {
+        liberacoes_perdidas++;
+    }
+
+    slot_atual = (slot + 1 == num_slots) ? 0 : slot + 1;
+    return true;
+}
+
+void despachante_inicia(const despachante_slot_t *tabela, uint32_t n_slots, uint32_t slot_ms) {
+    slots = tabela;
+    num_slots = (n_slots > DESPACHANTE_MAX_SLOTS) ? DESPACHANTE_MAX_SLOTS : n_slots;
+    duracao_slot_us = slot_ms * 1000;
+
+    for (uint32_t i = 0; i < num_slots; i++) {
+        estat[i] = (despachante_estat_t){ .folga_min_us = INT32_MAX };
+    }
+
+    // Período negativo: o intervalo é contado entre aberturas, sem acumular deriva
+    add_repeating_timer_ms(-(int32_t)slot_ms, abre_slot, NULL, &timer);
+}
+
+int despachante_executa_pendente(void) {
+    if (fila_leitura == fila_escrita) {
+        return -1;
+    }
+
+    liberacao_t lib = fila[fila_leitura % DESPACHANTE_FILA];
+    fila_leitura++;
+
+    const despachante_slot_t *s = &slots[lib.slot];
+    despachante_estat_t *e = &estat[lib.slot];
+
+    if (s->funcao == NULL) {
+        return lib.slot;   // Slot livre
+    }
+
+    uint32_t inicio = time_us_32();
+    s->funcao();
+    uint32_t fim = time_us_32();
+
+    uint32_t execucao = fim - inicio;
+    uint32_t atraso = inicio - lib.abertura_us;
+    int32_t folga = (int32_t)(lib.abertura_us + duracao_slot_us - fim);
+
+    e->execucoes++;
+    if (execucao > s->orcamento_us) e->estouros++;
+    if (folga < 0) e->prazos_perdidos++;
+    if (execucao > e->exec_max_us) e->exec_max_us = execucao;
+    if (atraso > e->atraso_max_us) e->atraso_max_us = atraso;
+    if (folga < e->folga_min_us) e->folga_min_us = folga;
+    e->folga_soma_us += folga;
+
+    return lib.slot;
+}
+
+const despachante_estat_t *despachante_estatisticas(uint32_t slot) {
+    return &estat[slot];
+}
+
+uint32_t despachante_liberacoes_perdidas(void) {
+    return liberacoes_perdidas;
+}
+
+void despachante_imprime(void) {
+    printf("[SLOTS] %lu slots de %lu ms | liberações perdidas: %lu\n",
+           (unsigned long)num_slots, (unsigned long)(duracao_slot_us / 1000),
+           (unsigned long)liberacoes_perdidas);
+
+    for (uint32_t i = 0; i < num_slots; i++) {
+        const despachante_estat_t *e = &estat[i];
+        if (slots[i].funcao == NULL || e->execucoes == 0) {
+            continue;
+        }
+        printf("  %u %-12s exec %lu | max %lu us (orç. %lu) | estouros %lu | prazos perdidos %lu | "
+               "folga min %ld méd %ld us | atraso início max %lu us\n",
+               (unsigned)i, slots[i].nome, (unsigned long)e->execucoes,
+               (unsigned long)e->exec_max_us, (unsigned long)slots[i].orcamento_us,
+               (unsigned long)e->estouros, (unsigned long)e->prazos_perdidos,
+               (long)e->folga_min_us, (long)(e->folga_soma_us / (int64_t)e->execucoes),
+               (unsigned long)e->atraso_max_us);
+    }
+}
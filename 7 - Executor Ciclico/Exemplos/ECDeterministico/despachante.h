@@ -0,0 +1,79 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: despachante.h
+ *  Projeto: ECDeterministico
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Despachante determinístico por slots de tempo. Um timer
+ *      repetitivo de hardware abre um slot a cada slot_ms e
+ *      libera a tarefa daquele slot: a interrupção só coloca o
+ *      slot e o instante de abertura numa fila curta; a tarefa
+ *      roda no contexto principal (despachante_executa_pendente).
+ *
+ *      O prazo de cada tarefa é o fim do seu slot. Por tarefa
+ *      são contados:
+ *        - estouros: execução acima do orçamento;
+ *        - prazos perdidos: término depois do fim do slot;
+ *        - folga: tempo entre o término e o fim do slot (mínima
+ *          e média);
+ *        - atraso de início (jitter): do instante de abertura do
+ *          slot até a tarefa começar (máximo).
+ *
+ *      A tabela de slots é de cada projeto: um vetor de
+ *      despachante_slot_t, um slot por posição do ciclo (função
+ *      NULL = slot livre).
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#ifndef DESPACHANTE_H
+#define DESPACHANTE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define DESPACHANTE_MAX_SLOTS 16
+#define DESPACHANTE_FILA 4          // Liberações pendentes que cabem na fila
+
+typedef struct {
+    const char *nome;
+    void (*funcao)(void);
+    uint32_t orcamento_us;
+} despachante_slot_t;
+
+typedef struct {
+    uint32_t execucoes;
+    uint32_t estouros;          // Execução > orçamento
+    uint32_t prazos_perdidos;   // Término depois do fim do slot
+    uint32_t exec_max_us;
+    uint32_t atraso_max_us;     // Abertura do slot -> início da tarefa
+    int32_t folga_min_us;       // Negativa quando o prazo foi perdido
+    int64_t folga_soma_us;
+} despachante_estat_t;
+
+/**
+ * @brief Guarda a tabela e arma o timer que abre um slot a cada `slot_ms`.
+ */
+void despachante_inicia(const despachante_slot_t *tabela, uint32_t n_slots, uint32_t slot_ms);
+
+/**
+ * @brief Executa a próxima tarefa liberada, se houver.
+ *
+ * @return Índice do slot executado, ou -1 se a fila estava vazia.
+ */
+int despachante_executa_pendente(void);
+
+const despachante_estat_t *despachante_estatisticas(uint32_t slot);
+
+/**
+ * @brief Liberações descartadas porque a fila estava cheia.
+ */
+uint32_t despachante_liberacoes_perdidas(void);
+
+/**
+ * @brief Imprime uma linha por slot com os contadores e a folga.
+ */
+void despachante_imprime(void);
+
+#endif  // DESPACHANTE_H
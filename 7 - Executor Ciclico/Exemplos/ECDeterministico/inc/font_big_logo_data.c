@@ -1,174 +1,112 @@
 #include "font_big_logo.h"
 #include <stdint.h>
 
+// Glifos 16x32 já no formato de página do SSD1306 (ver font_big_logo.h):
+// 4 páginas × 16 colunas, bit 0 de cada byte = linha superior da página.
 
 const uint8_t big_digit_0[64] = {
-  0x3C,0x00, 0x42,0x00, 0x81,0x00, 0x81,0x00,
-  0x81,0x00, 0x81,0x00, 0x81,0x00, 0x81,0x00,
-  0x81,0x00, 0x81,0x00, 0x42,0x00, 0x3C,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0xFC, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0xFC,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x03, 0x04, 0x08, 0x08, 0x08, 0x08, 0x04, 0x03,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
 const uint8_t big_digit_1[64] = {
-  0x10,0x00, 0x30,0x00, 0x50,0x00, 0x10,0x00,
-  0x10,0x00, 0x10,0x00, 0x10,0x00, 0x10,0x00,
-  0x10,0x00, 0x10,0x00, 0x10,0x00, 0x10,0x00,
-  0x10,0x00, 0x10,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x00, 0x04, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
 const uint8_t big_digit_2[64] = {
-  0x3C,0x00, 0x42,0x00, 0x01,0x00, 0x01,0x00,
-  0x02,0x00, 0x04,0x00, 0x08,0x00, 0x10,0x00,
-  0x20,0x00, 0x40,0x00, 0x40,0x00, 0x7F,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x00, 0x02, 0x01, 0x81, 0x41, 0x21, 0x12, 0x0C,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x00, 0x0E, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
 const uint8_t big_digit_3[64] = {
-  0x3C,0x00, 0x42,0x00, 0x01,0x00, 0x06,0x00,
-  0x18,0x00, 0x06,0x00, 0x01,0x00, 0x01,0x00,
-  0x01,0x00, 0x42,0x00, 0x3C,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x00, 0x02, 0x01, 0x11, 0x11, 0x29, 0x2A, 0xC4,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x00, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
 const uint8_t big_digit_4[64] = {
-  0x04,0x00, 0x0C,0x00, 0x14,0x00, 0x24,0x00,
-  0x44,0x00, 0x84,0x00, 0xFF,0x00, 0x04,0x00,
-  0x04,0x00, 0x04,0x00, 0x04,0x00, 0x04,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x60, 0x50, 0x48, 0x44, 0x42, 0xFF, 0x40, 0x40,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
 const uint8_t big_digit_5[64] = {
-  0x7E,0x00, 0x40,0x00, 0x40,0x00, 0x40,0x00,
-  0x7C,0x00, 0x02,0x00, 0x01,0x00, 0x01,0x00,
-  0x01,0x00, 0x42,0x00, 0x3C,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x00, 0x1F, 0x11, 0x11, 0x11, 0x11, 0x21, 0xC0,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x00, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
 const uint8_t big_digit_6[64] = {
-  0x3C,0x00, 0x42,0x00, 0x80,0x00, 0x80,0x00,
-  0xFC,0x00, 0xC2,0x00, 0x81,0x00, 0x81,0x00,
-  0x81,0x00, 0x42,0x00, 0x3C,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0xFC, 0x32, 0x11, 0x11, 0x11, 0x11, 0x22, 0xC0,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
 const uint8_t big_digit_7[64] = {
-  0x7F,0x00, 0x02,0x00, 0x04,0x00, 0x08,0x00,
-  0x10,0x00, 0x20,0x00, 0x20,0x00, 0x40,0x00,
-  0x40,0x00, 0x40,0x00, 0x40,0x00, 0x40,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x00, 0x81, 0x61, 0x11, 0x09, 0x05, 0x03, 0x01,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
 const uint8_t big_digit_8[64] = {
-  0x3C,0x00, 0x42,0x00, 0x81,0x00, 0x81,0x00,
-  0x42,0x00, 0x3C,0x00, 0x42,0x00, 0x81,0x00,
-  0x81,0x00, 0x42,0x00, 0x3C,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x8C, 0x52, 0x21, 0x21, 0x21, 0x21, 0x52, 0x8C,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
 const uint8_t big_digit_9[64] = {
-  0x3C,0x00, 0x42,0x00, 0x81,0x00, 0x81,0x00,
-  0x81,0x00, 0x43,0x00, 0x3D,0x00, 0x01,0x00,
-  0x01,0x00, 0x42,0x00, 0x3C,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x1C, 0x22, 0x41, 0x41, 0x41, 0x41, 0x22, 0xFC,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x00, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
 // --- Caracteres Especiais ---
 
 const uint8_t big_char_plus[64] = {
-  0x00,0x00, 0x00,0x00, 0x08,0x00, 0x08,0x00,
-  0x08,0x00, 0xFF,0x00, 0x08,0x00, 0x08,0x00,
-  0x08,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x20, 0x20, 0x20, 0x20, 0xFC, 0x20, 0x20, 0x20,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
-
 const uint8_t big_char_minus[64] = {
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0xFF,0x00,  // linha horizontal central
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
-
 const uint8_t big_char_dot[64] = {
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0xC0,0x00, 0xC0,0x00, 0xC0,0x00, // pixels mais à esquerda
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
 const uint8_t big_char_degree[64] = {
-  0x0E,0x00, 0x11,0x00, 0x11,0x00, 0x0E,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
 
-
 const uint8_t big_char_C[64] = {
-  0x3C,0x00, 0x42,0x00, 0x81,0x00, 0x80,0x00,
-  0x80,0x00, 0x80,0x00, 0x80,0x00, 0x81,0x00,
-  0x42,0x00, 0x3C,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00,
-  0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
+  0xFC, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x84,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 0
+  0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // página 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // página 3
 };
-
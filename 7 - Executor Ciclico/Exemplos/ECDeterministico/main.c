@@ -2,6 +2,7 @@
 #include "pico/stdlib.h"
 #include "hardware/watchdog.h"
 #include "hardware/timer.h"
+#include "hardware/sync.h"
 
 #include "setup.h"
 #include "tarefa1_temp.h"
@@ -11,13 +12,11 @@
 #include "neopixel_driver.h"
 #include "testes_cores.h"
 #include "pico/stdio_usb.h"
+#include "despachante.h"
 
 #define NUM_TAREFAS 5
 #define SLOT_MS 1000
 
-// Estados
-volatile int tarefa_atual = 0;
-
 // Tempo de execução por tarefa
 absolute_time_t ini_tarefa1, fim_tarefa1;
 absolute_time_t ini_tarefa2, fim_tarefa2;
@@ -35,21 +34,28 @@ void tarefa_3();
 void tarefa_4();
 void tarefa_5();
 
-bool timer_callback(repeating_timer_t *rt) {
-    if(tarefa_atual == 0){
-        printf("tarefa 1\n");
-    }
-}
+// Tabela de slots: uma tarefa por slot de SLOT_MS, na ordem do ciclo.
+// O orçamento é o tempo de execução esperado; o prazo é sempre o fim do slot.
+static const despachante_slot_t slots[NUM_TAREFAS] = {
+    { "temperatura", tarefa_1, 550000 },   // 0,5 s de aquisição ADC + DMA
+    { "tendencia",   tarefa_2,   1000 },
+    { "oled",        tarefa_3,  60000 },
+    { "neopixel",    tarefa_4,   2000 },
+    { "alerta",      tarefa_5,   1000 },
+};
 
 int main() {
     setup();
 
-    static repeating_timer_t timer;
-    printf("Before timer\n");
-    add_repeating_timer_ms(SLOT_MS, timer_callback, NULL, &timer);
-    printf("after timer\n");
+    despachante_inicia(slots, NUM_TAREFAS, SLOT_MS);
+
     while (true) {
-        tight_loop_contents();
+        int slot = despachante_executa_pendente();
+        if (slot < 0) {
+            __wfi();   // Nada liberado: dorme até a próxima interrupção
+        } else if (slot == NUM_TAREFAS - 1) {
+            despachante_imprime();   // Fim do ciclo, dentro da folga do último slot
+        }
     }
 
     return 0;
@@ -0,0 +1,46 @@
+#include <string.h>
+#include "ssd1306.h"
+#include "draw_big_char.h"
+
+#define BIG_CHAR_WIDTH 16
+#define BIG_CHAR_PAGES 4
+
+// Copia o glifo página a página: com y múltiplo de 8 cada página é um memcpy de
+// 16 bytes; caso contrário cada coluna é deslocada e mesclada nas duas páginas cobertas.
+void draw_big_char(uint8_t *ssd, int x, int y, const uint8_t *bitmap) {
+    int col0 = x < 0 ? -x : 0;
+    int col1 = x + BIG_CHAR_WIDTH > ssd1306_width ? ssd1306_width - x : BIG_CHAR_WIDTH;
+    if (col0 >= col1 || y <= -32 || y >= ssd1306_height) {
+        return;
+    }
+
+    int n = col1 - col0;
+    int shift = y & 7;
+    int page_base = (y - shift) / 8;   // arredonda para baixo também com y negativo
+
+    for (int p = 0; p < BIG_CHAR_PAGES; p++) {
+        const uint8_t *src = &bitmap[p * BIG_CHAR_WIDTH + col0];
+        int dp = page_base + p;
+
+        if (shift == 0) {
+            if (dp >= 0 && dp < ssd1306_n_pages) {
+                memcpy(&ssd[dp * ssd1306_width + x + col0], src, n);
+            }
+            continue;
+        }
+
+        uint8_t mask_lo = (uint8_t)(0xFF << shift);
+        if (dp >= 0 && dp < ssd1306_n_pages) {
+            uint8_t *dst = &ssd[dp * ssd1306_width + x + col0];
+            for (int c = 0; c < n; c++) {
+                dst[c] = (dst[c] & ~mask_lo) | (uint8_t)(src[c] << shift);
+            }
+        }
+        if (dp + 1 >= 0 && dp + 1 < ssd1306_n_pages) {
+            uint8_t *dst = &ssd[(dp + 1) * ssd1306_width + x + col0];
+            for (int c = 0; c < n; c++) {
+                dst[c] = (dst[c] & mask_lo) | (uint8_t)(src[c] >> (8 - shift));
+            }
+        }
+    }
+}
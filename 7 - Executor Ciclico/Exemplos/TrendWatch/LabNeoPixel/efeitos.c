@@ -4,44 +4,52 @@
 #include "testes_cores.h"
 #include <stdlib.h> 
 
+// Ordem de preenchimento da espiral (índices na cadeia) para a geometria de np_geometria.h:
+// do canto superior esquerdo ao centro, em sentido horário, camada por camada. Montada na
+// primeira chamada; a espiral inversa é a mesma ordem lida de trás para frente.
+static npIndex_t ordem_espiral[LED_COUNT];
+
+const npIndex_t *ordemEspiral(void) {
+    static bool pronta = false;
+    if (pronta) {
+        return ordem_espiral;
+    }
+
+    uint n = 0;
+    int x0 = 0, y0 = 0, x1 = NUM_COLUNAS - 1, y1 = NUM_LINHAS - 1;
+    while (x0 <= x1 && y0 <= y1) {
+        for (int x = x0; x <= x1; ++x) ordem_espiral[n++] = getLEDIndex(x, y0);
+        for (int y = y0 + 1; y <= y1; ++y) ordem_espiral[n++] = getLEDIndex(x1, y);
+        if (y0 < y1) {
+            for (int x = x1 - 1; x >= x0; --x) ordem_espiral[n++] = getLEDIndex(x, y1);
+        }
+        if (x0 < x1) {
+            for (int y = y1 - 1; y > y0; --y) ordem_espiral[n++] = getLEDIndex(x0, y);
+        }
+        ++x0; ++y0; --x1; --y1;
+    }
+    pronta = true;
+    return ordem_espiral;
+}
 
 // Acende todos os LEDs de uma linha
 void acenderFileira(uint8_t y, uint8_t r, uint8_t g, uint8_t b) {
-    for (uint x = 0; x < NUM_COLUNAS; x++) {
-        uint index = getLEDIndex(x, y);
-        npSetLED(index, r, g, b);
-    }
+    npSetFileira(y, r, g, b);
     npWrite();
 }
 
 // Acende todos os LEDs de uma coluna
 void acenderColuna(uint8_t x, uint8_t r, uint8_t g, uint8_t b) {
-    for (uint y = 0; y < NUM_LINHAS; y++) {
-        uint index = getLEDIndex(x, y);
-        npSetLED(index, r, g, b);
-    }
+    npSetColuna(x, r, g, b);
     npWrite();
 }
 
 // Preenche a matriz em espiral do canto superior esquerdo ao centro
 void efeitoEspiral(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    const uint8_t ordem_espiral[25][2] = {
-        {0,0},{1,0},{2,0},{3,0},{4,0},
-        {4,1},{4,2},{4,3},{4,4},
-        {3,4},{2,4},{1,4},{0,4},
-        {0,3},{0,2},{0,1},
-        {1,1},{2,1},{3,1},
-        {3,2},{3,3},
-        {2,3},{1,3},
-        {1,2},{2,2}
-    };
-
+    const npIndex_t *ordem = ordemEspiral();
     npClear();
-    for (uint i = 0; i < 25; ++i) {
-        uint x = ordem_espiral[i][0];
-        uint y = ordem_espiral[i][1];
-        uint index = getLEDIndex(x, y);
-        npSetLED(index, r, g, b);
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        npSetLED(ordem[i], r, g, b);
         npWrite();
         sleep_ms(delay_ms);
     }
@@ -65,25 +73,12 @@ void efeitoOndaVertical(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
     }
 }
 
-// Preenche a matriz em espiral do canto superior esquerdo ao centro, inversa.
+// Preenche a matriz em espiral do centro ao canto superior esquerdo (inversa)
 void efeitoEspiralInversa(uint8_t r, uint8_t g, uint8_t b, uint16_t delay_ms) {
-    const uint8_t ordem_espiral[25][2] = {
-        {2,2},{1,2},{1,3},{2,3},{3,3},
-        {3,2},{3,1},{2,1},{1,1},
-        {0,1},{0,2},{0,3},{0,4},
-        {1,4},{2,4},{3,4},
-        {4,4},{4,3},{4,2},
-        {4,1},{4,0},
-        {3,0},{2,0},
-        {1,0},{0,0}
-    };
-
+    const npIndex_t *ordem = ordemEspiral();
     npClear();
-    for (uint i = 0; i < 25; ++i) {
-        uint x = ordem_espiral[i][0];
-        uint y = ordem_espiral[i][1];
-        uint index = getLEDIndex(x, y);
-        npSetLED(index, r, g, b);
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        npSetLED(ordem[LED_COUNT - 1 - i], r, g, b);
         npWrite();
         sleep_ms(delay_ms);
     }
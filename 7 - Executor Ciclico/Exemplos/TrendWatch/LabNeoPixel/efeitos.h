@@ -3,7 +3,10 @@
 
 #include <stdint.h>
 #include "LabNeoPixel/efeitos.h"
+#include "LabNeoPixel/np_geometria.h"
 
+// Ordem da espiral com LED_COUNT índices, do canto ao centro (também usada por np_anim.c)
+const npIndex_t *ordemEspiral(void);
 
 void acenderFileira(uint8_t y, uint8_t r, uint8_t g, uint8_t b);
 void acenderColuna(uint8_t y, uint8_t r, uint8_t g, uint8_t b);
@@ -0,0 +1,17 @@
+#ifndef HOST_HARDWARE_IRQ_H
+#define HOST_HARDWARE_IRQ_H
+
+// Só DMA_IRQ_1, a linha do NeoPixel: o tratador registrado é chamado pelo DMA substituto
+
+#include "pico/stdlib.h"
+
+typedef void (*irq_handler_t)(void);
+
+#define DMA_IRQ_1 12
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority);
+
+static inline void irq_set_enabled(uint num, bool enabled) { (void)num; (void)enabled; }
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef HOST_HARDWARE_PIO_H
+#define HOST_HARDWARE_PIO_H
+
+// PIO substituta: a TX FIFO não enche nem guarda nada; as palavras de pio_sm_put_blocking()
+// vão para host_pio_palavras[] (o envio bloqueante npWrite()).
+
+#include "pico/stdlib.h"
+
+typedef struct { volatile uint32_t txf[4]; } pio_hw_t;
+typedef pio_hw_t *PIO;
+
+typedef struct {
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+} pio_program_t;
+
+extern pio_hw_t host_pio0;
+#define pio0 (&host_pio0)
+
+extern uint32_t host_pio_palavras[];
+extern uint host_pio_total;
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data);
+
+static inline uint pio_add_program(PIO pio, const pio_program_t *program) { (void)pio; (void)program; return 0; }
+static inline void pio_sm_claim(PIO pio, uint sm) { (void)pio; (void)sm; }
+static inline void pio_sm_unclaim(PIO pio, uint sm) { (void)pio; (void)sm; }
+static inline void pio_sm_set_enabled(PIO pio, uint sm, bool enabled) { (void)pio; (void)sm; (void)enabled; }
+static inline uint pio_sm_get_tx_fifo_level(PIO pio, uint sm) { (void)pio; (void)sm; return 0; }
+static inline uint pio_get_dreq(PIO pio, uint sm, bool is_tx) { (void)pio; (void)sm; (void)is_tx; return 0; }
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef HOST_PICO_STDLIB_H
+#define HOST_PICO_STDLIB_H
+
+// Substituto mínimo do Pico SDK para compilar o LabNeoPixel no PC (ver teste_neopixel_host.c).
+// Só o que neopixel_driver.c, efeitos.c e np_anim.c usam; as funções ficam em pico_host.c.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "pico/time.h"
+
+typedef unsigned int uint;
+
+void sleep_ms(uint32_t ms);   // Avança o relógio simulado (dispara os alarmes vencidos)
+
+static inline void tight_loop_contents(void) {}
+
+#endif
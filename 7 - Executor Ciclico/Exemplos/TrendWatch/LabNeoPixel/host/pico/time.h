@@ -0,0 +1,27 @@
+#ifndef HOST_PICO_TIME_H
+#define HOST_PICO_TIME_H
+
+// Tempo simulado: o relógio só anda com host_avanca_us() (ou sleep_ms()), e os alarmes
+// vencidos são chamados nesse momento, na ordem dos instantes. Assim um teste percorre
+// segundos de animação em microssegundos de PC, sempre com o mesmo resultado.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint64_t absolute_time_t;
+typedef int32_t alarm_id_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void *user_data);
+
+#define nil_time ((absolute_time_t)0)
+
+static inline bool is_nil_time(absolute_time_t t) { return t == nil_time; }
+static inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to) {
+    return (int64_t)(to - from);
+}
+
+absolute_time_t get_absolute_time(void);
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past);
+
+void host_avanca_us(uint64_t us);
+
+#endif
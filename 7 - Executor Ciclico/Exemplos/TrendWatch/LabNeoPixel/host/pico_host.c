@@ -0,0 +1,117 @@
+// Implementação dos substitutos do Pico SDK do build de PC (ver pico/time.h e hardware/)
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "np_geometria.h"
+
+#define HOST_ALARMES 8
+#define HOST_PALAVRAS (LED_COUNT > 64 ? LED_COUNT : 64)
+
+static absolute_time_t relogio_us = 1;   // 0 é nil_time
+
+static struct {
+    bool ativo;
+    absolute_time_t quando;
+    alarm_callback_t callback;
+    void *user_data;
+} alarmes[HOST_ALARMES];
+
+pio_hw_t host_pio0;
+uint32_t host_pio_palavras[HOST_PALAVRAS];
+uint host_pio_total;
+
+uint32_t host_dma_palavras[HOST_PALAVRAS];
+uint host_dma_total;
+uint host_dma_quadros;
+
+static irq_handler_t tratador_dma_irq1;
+static bool irq1_habilitada, irq1_pendente;
+
+absolute_time_t get_absolute_time(void) {
+    return relogio_us;
+}
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past) {
+    (void)fire_if_past;
+    for (int i = 0; i < HOST_ALARMES; i++) {
+        if (!alarmes[i].ativo) {
+            alarmes[i].ativo = true;
+            alarmes[i].quando = relogio_us + us;
+            alarmes[i].callback = callback;
+            alarmes[i].user_data = user_data;
+            return i + 1;
+        }
+    }
+    return -1;
+}
+
+// Avança até `relogio_us + us`, parando em cada alarme vencido (o mais cedo primeiro)
+void host_avanca_us(uint64_t us) {
+    absolute_time_t fim = relogio_us + us;
+    for (;;) {
+        int proximo = -1;
+        for (int i = 0; i < HOST_ALARMES; i++) {
+            if (alarmes[i].ativo && alarmes[i].quando <= fim &&
+                (proximo < 0 || alarmes[i].quando < alarmes[proximo].quando)) {
+                proximo = i;
+            }
+        }
+        if (proximo < 0) {
+            break;
+        }
+        if (alarmes[proximo].quando > relogio_us) {
+            relogio_us = alarmes[proximo].quando;
+        }
+        alarmes[proximo].ativo = false;
+        alarmes[proximo].callback(proximo + 1, alarmes[proximo].user_data);
+    }
+    relogio_us = fim;
+}
+
+void sleep_ms(uint32_t ms) {
+    host_avanca_us((uint64_t)ms * 1000u);
+}
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data) {
+    (void)pio; (void)sm;
+    if (host_pio_total < HOST_PALAVRAS) {
+        host_pio_palavras[host_pio_total++] = data;
+    }
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority) {
+    (void)order_priority;
+    if (num == DMA_IRQ_1) {
+        tratador_dma_irq1 = handler;
+    }
+}
+
+void dma_channel_set_irq1_enabled(uint ch, bool enabled) {
+    (void)ch;
+    irq1_habilitada = enabled;
+}
+
+bool dma_channel_get_irq1_status(uint ch) {
+    (void)ch;
+    return irq1_pendente;
+}
+
+void dma_channel_acknowledge_irq1(uint ch) {
+    (void)ch;
+    irq1_pendente = false;
+}
+
+void dma_channel_transfer_from_buffer_now(uint ch, const volatile void *read_addr, uint32_t count) {
+    (void)ch;
+    host_dma_total = count < HOST_PALAVRAS ? count : HOST_PALAVRAS;
+    memcpy(host_dma_palavras, (const void *)read_addr, host_dma_total * sizeof(uint32_t));
+    host_dma_quadros++;
+
+    if (irq1_habilitada && tratador_dma_irq1) {
+        irq1_pendente = true;
+        tratador_dma_irq1();
+    }
+}
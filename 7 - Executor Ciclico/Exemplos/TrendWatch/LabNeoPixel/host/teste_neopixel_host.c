@@ -0,0 +1,319 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: teste_neopixel_host.c
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Ferramenta de PC (não entra no firmware) que roda o
+ *      motor de animação np_anim.c sobre o neopixel_driver.c
+ *      sem alterações, com os substitutos do Pico SDK desta
+ *      pasta (pico/, hardware/, pico_host.c).
+ *
+ *      O tempo é simulado: cada tick avança o relógio em 1 ms
+ *      e o fim do quadro (DMA + reset) vem do mesmo alarme do
+ *      firmware. Os testes conferem:
+ *        - alerta da tarefa 4: cor fixa na camada 0 e três
+ *          piscadas brancas de 150 ms na camada 1, que depois
+ *          se desliga; quadros enviados no ritmo do FPS;
+ *        - espiral: a ordem gerada para NUM_COLUNAS x
+ *          NUM_LINHAS passa por todos os LEDs, de vizinho em
+ *          vizinho (no 5x5, igual à tabela antiga); o efeito
+ *          acende um LED novo por passo e nada fica aceso
+ *          depois da última execução;
+ *        - misturas: substitui, soma saturada e máximo;
+ *        - quadro em voo: npWriteAsync() recusa até passar
+ *          NP_US_POR_LED + NP_RESET_US;
+ *        - emulador da PIO: as palavras de npWrite() e do DMA
+ *          são as de npEmpacota(), e esse quadro, rodado em
+ *          ws2818b_emu.c (npEmuConfig) a 48, 125, 133 e 200 MHz,
+ *          chega aos LEDs sem bits errados, dentro das faixas
+ *          do WS2812 e com a espera do driver cobrindo o fim.
+ *
+ *      Com "quadros", imprime cada quadro da espiral como uma
+ *      grade (# aceso, . apagado), linha 0 em cima. Outras
+ *      geometrias: acrescentar à linha do gcc, por exemplo,
+ *      -DNP_PAINEL_LARGURA=8 -DNP_PAINEL_ALTURA=4.
+ *
+ *      O código de saída é o número de falhas.
+ *
+ *      Uso (a partir de TrendWatch/):
+ *          gcc -O2 -std=gnu11 -Wall -ILabNeoPixel/host -I. -ILabNeoPixel \
+ *              LabNeoPixel/host/teste_neopixel_host.c LabNeoPixel/host/pico_host.c \
+ *              LabNeoPixel/neopixel_driver.c LabNeoPixel/np_anim.c LabNeoPixel/efeitos.c \
+ *              LabNeoPixel/neopixel_emu.c LabNeoPixel/ws2818b_emu.c -lm -o teste_neopixel_host
+ *          ./teste_neopixel_host [quadros]
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "neopixel_driver.h"
+#include "neopixel_emu.h"
+#include "efeitos.h"
+#include "np_anim.h"
+#include "testes_cores.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+
+static int falhas = 0;
+static bool imprime_quadros = false;
+
+#define CONFERE(cond, ...)                      \
+    do {                                        \
+        if (!(cond)) {                          \
+            printf("  FALHA: " __VA_ARGS__);    \
+            printf("\n");                       \
+            falhas++;                           \
+        }                                       \
+    } while (0)
+
+static bool led_igual(npIndex_t i, uint8_t r, uint8_t g, uint8_t b) {
+    return leds[i].R == r && leds[i].G == g && leds[i].B == b;
+}
+
+static uint leds_acesos(void) {
+    uint n = 0;
+    for (uint i = 0; i < LED_COUNT; i++) {
+        n += (leds[i].R | leds[i].G | leds[i].B) != 0;
+    }
+    return n;
+}
+
+static void imprime_quadro(void) {
+    for (uint y = 0; y < NUM_LINHAS; y++) {
+        printf("  ");
+        for (uint x = 0; x < NUM_COLUNAS; x++) {
+            npLED_t *p = &leds[getLEDIndex(x, y)];
+            putchar((p->R | p->G | p->B) ? '#' : '.');
+        }
+        putchar('\n');
+    }
+    putchar('\n');
+}
+
+// Camada 0 fixa, três piscadas na camada 1 (tarefa4_matriz_cor_por_tendencia)
+static void teste_alerta(void) {
+    const uint duracao_ms = 1200;
+
+    printf("Alerta da tarefa 4 (%u ms a %u fps)\n", duracao_ms, NP_ANIM_FPS);
+    np_anim_init(NP_ANIM_FPS);
+    np_anim_inicia(0, NP_ANIM_COR_FIXA, COR_APAGA, COR_APAGA, COR_APAGA, 1000, NP_MISTURA_SUBSTITUI, 0);
+    np_anim_cor(0, COR_AZUL);
+    np_anim_inicia(1, NP_ANIM_PISCA, COR_BRANCA, 150, NP_MISTURA_SUBSTITUI, 3);
+
+    uint quadros = 0, brancos = 0, piscadas = 0, desligou_ms = 0;
+    bool anterior_branco = false;
+    for (uint t = 0; t < duracao_ms; t++) {
+        if (np_anim_tick(get_absolute_time())) {
+            bool branco = led_igual(0, COR_BRANCA);
+            CONFERE(branco || led_igual(0, COR_AZUL), "quadro %u fora das duas cores", quadros);
+            brancos += branco;
+            piscadas += branco && !anterior_branco;
+            anterior_branco = branco;
+            quadros++;
+            CONFERE(host_dma_total == LED_COUNT, "DMA com %u palavras", host_dma_total);
+        }
+        if (!desligou_ms && !np_anim_ativa(1)) {
+            desligou_ms = t;
+        }
+        host_avanca_us(1000);
+    }
+
+    uint esperados = duracao_ms * NP_ANIM_FPS / 1000;
+    printf("  %u quadros (esperados ~%u), %u brancos em %u piscadas, camada 1 desligada em %u ms\n",
+           quadros, esperados, brancos, piscadas, desligou_ms);
+    CONFERE(quadros + 1 >= esperados && quadros <= esperados + 1, "ritmo de quadros");
+    CONFERE(piscadas == 3, "%u piscadas", piscadas);
+    CONFERE(desligou_ms >= 900 && desligou_ms < 900 + 1000 / NP_ANIM_FPS + 2, "fim da camada 1");
+}
+
+// Ordem {x, y} da matriz 5x5 como era escrita em efeitos.c, para conferir a ordem gerada
+static const uint8_t espiral_5x5[25][2] = {
+    {0,0},{1,0},{2,0},{3,0},{4,0},
+    {4,1},{4,2},{4,3},{4,4},
+    {3,4},{2,4},{1,4},{0,4},
+    {0,3},{0,2},{0,1},
+    {1,1},{2,1},{3,1},
+    {3,2},{3,3},
+    {2,3},{1,3},
+    {1,2},{2,2}
+};
+
+// Posição lógica de um índice da cadeia (busca inversa em np_mapa_xy)
+static uint posicao(npIndex_t indice) {
+    for (uint k = 0; k < LED_COUNT; k++) {
+        if (np_mapa_xy[k] == indice) {
+            return k;
+        }
+    }
+    return LED_COUNT;
+}
+
+// ordemEspiral(): permutação da matriz, cada LED vizinho do anterior, começando em (0, 0)
+static void teste_ordem_espiral(void) {
+    const npIndex_t *ordem = ordemEspiral();
+    bool visto[LED_COUNT] = { false };
+    uint repetidos = 0, saltos = 0;
+
+    printf("Ordem da espiral (%ux%u)\n", NUM_COLUNAS, NUM_LINHAS);
+    CONFERE(ordem[0] == getLEDIndex(0, 0), "não começa em (0, 0)");
+    for (uint i = 0; i < LED_COUNT; i++) {
+        uint k = posicao(ordem[i]);
+        if (k >= LED_COUNT || visto[k]) {
+            repetidos++;
+            continue;
+        }
+        visto[k] = true;
+        if (i > 0) {
+            uint a = posicao(ordem[i - 1]);
+            int dx = (int)(k % NUM_COLUNAS) - (int)(a % NUM_COLUNAS);
+            int dy = (int)(k / NUM_COLUNAS) - (int)(a / NUM_COLUNAS);
+            saltos += (dx * dx + dy * dy) != 1;
+        }
+    }
+    CONFERE(repetidos == 0, "%u LEDs repetidos ou fora da matriz", repetidos);
+    CONFERE(saltos == 0, "%u passos entre LEDs não vizinhos", saltos);
+
+    if (NUM_COLUNAS == 5 && NUM_LINHAS == 5) {
+        uint diferentes = 0;
+        for (uint i = 0; i < 25; i++) {
+            diferentes += ordem[i] != getLEDIndex(espiral_5x5[i][0], espiral_5x5[i][1]);
+        }
+        CONFERE(diferentes == 0, "%u posições diferentes da tabela 5x5 antiga", diferentes);
+    }
+}
+
+// Um LED novo por passo, na ordem de ordemEspiral() (ao contrário na inversa)
+static void teste_espiral(np_anim_efeito_t efeito, bool inversa, const char *nome) {
+    const uint passo_ms = 40;   // Maior que o intervalo do FPS: um quadro por passo ao menos
+    const npIndex_t *ordem = ordemEspiral();
+
+    printf("%s (%u passos de %u ms)\n", nome, LED_COUNT, passo_ms);
+    np_anim_init(NP_ANIM_FPS);
+    np_anim_inicia(0, efeito, COR_VERDE, passo_ms, NP_MISTURA_SUBSTITUI, 1);
+
+    uint passo_visto = 0, erros = 0;
+    for (uint t = 0; t < (LED_COUNT + 2) * passo_ms; t++) {
+        if (np_anim_tick(get_absolute_time())) {
+            uint passo = t / passo_ms;
+            uint acesos = leds_acesos();
+            if (passo < LED_COUNT) {
+                npIndex_t novo = inversa ? ordem[LED_COUNT - 1 - passo] : ordem[passo];
+                if (acesos != passo + 1 || !led_igual(novo, COR_VERDE)) {
+                    erros++;
+                }
+                if (imprime_quadros && passo == passo_visto) {
+                    printf("  passo %u\n", passo);
+                    imprime_quadro();
+                    passo_visto++;
+                }
+            } else if (acesos) {
+                erros++;
+            }
+        }
+        host_avanca_us(1000);
+    }
+    CONFERE(erros == 0, "%u quadros fora da ordem", erros);
+    CONFERE(!np_anim_ativa(0), "camada ainda ativa");
+}
+
+static void teste_misturas(void) {
+    printf("Misturas\n");
+    np_anim_init(NP_ANIM_FPS);
+
+    np_anim_inicia(0, NP_ANIM_COR_FIXA, 100, 0, 200, 1000, NP_MISTURA_SUBSTITUI, 0);
+    np_anim_inicia(1, NP_ANIM_COR_FIXA, 200, 50, 100, 1000, NP_MISTURA_SOMA, 0);
+    np_anim_tick(get_absolute_time());
+    CONFERE(led_igual(0, 255, 50, 255), "soma (%u, %u, %u)", leds[0].R, leds[0].G, leds[0].B);
+    host_avanca_us(100000);
+
+    np_anim_inicia(1, NP_ANIM_COR_FIXA, 200, 50, 100, 1000, NP_MISTURA_MAX, 0);
+    np_anim_tick(get_absolute_time());
+    CONFERE(led_igual(0, 200, 50, 200), "máximo (%u, %u, %u)", leds[0].R, leds[0].G, leds[0].B);
+    host_avanca_us(100000);
+
+    np_anim_inicia(1, NP_ANIM_PISCA, 0, 30, 0, 1000, NP_MISTURA_SUBSTITUI, 0);
+    np_anim_tick(get_absolute_time());
+    CONFERE(led_igual(0, 0, 30, 0), "substitui aceso (%u, %u, %u)", leds[0].R, leds[0].G, leds[0].B);
+    host_avanca_us(1000000);
+    np_anim_tick(get_absolute_time());
+    CONFERE(led_igual(0, 100, 0, 200), "substitui apagado (%u, %u, %u)", leds[0].R, leds[0].G, leds[0].B);
+    host_avanca_us(100000);
+}
+
+static void teste_quadro_em_voo(void) {
+    printf("Quadro em voo\n");
+    npWait();
+    CONFERE(npWriteAsync(), "envio recusado com a linha livre");
+    CONFERE(npBusy() && !npWriteAsync(), "segundo envio aceito com o quadro em voo");
+    host_avanca_us(NP_US_POR_LED + NP_RESET_US - 1);
+    CONFERE(npBusy(), "quadro terminou antes do reset");
+    host_avanca_us(1);
+    CONFERE(!npBusy(), "quadro não terminou depois do reset");
+}
+
+// Mesmo quadro de teste_emulador_neopixel() (testes_cores.c), aqui sem a placa
+static void teste_emulador(void) {
+    static uint32_t quadro[LED_COUNT];
+    static uint32_t grb[LED_COUNT];
+    const uint32_t clocks_hz[] = { 48000000, 125000000, 133000000, 200000000 };
+
+    printf("Emulador da PIO\n");
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        npSetLED(i, (i * 37) & 0xFF, 0xA5, 255 - i);
+    }
+    npSetDither(false);
+    npEmpacota(quadro);
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        grb[i] = quadro[i] >> 8;   // Bytes G, R, B já corrigidos, como o LED deve recebê-los
+    }
+
+    host_pio_total = 0;
+    npWrite();
+    CONFERE(host_pio_total == LED_COUNT && memcmp(host_pio_palavras, quadro, sizeof(quadro)) == 0,
+            "npWrite() enviou palavras diferentes de npEmpacota()");
+    npWait();
+    npWriteAsync();
+    CONFERE(host_dma_total == LED_COUNT && memcmp(host_dma_palavras, quadro, sizeof(quadro)) == 0,
+            "npWriteAsync() enviou palavras diferentes de npEmpacota()");
+    host_avanca_us(NP_US_POR_LED + NP_RESET_US);
+    npClear();
+
+    for (uint k = 0; k < sizeof(clocks_hz) / sizeof(clocks_hz[0]); k++) {
+        ws2818b_emu_config_t cfg;
+        ws2818b_emu_resultado_t r;
+
+        npEmuConfig(&cfg, clocks_hz[k]);
+        int erros = ws2818b_emu_run(&cfg, quadro, LED_COUNT, grb, LED_COUNT, NP_RESET_US,
+                                    NULL, 0, NULL, &r);
+
+        uint32_t restante_ns = r.duracao_ns - r.t_ultimo_push_ns;
+        bool espera_ok = (r.nivel_fifo + 1u) * NP_US_POR_LED * 1000u >= restante_ns;
+
+        printf("  clk_sys %lu Hz, clkdiv %u + %u/256\n",
+               (unsigned long)clocks_hz[k], cfg.clkdiv_int, cfg.clkdiv_frac);
+        ws2818b_emu_imprime(&r);
+        CONFERE(erros == 0, "%d erro(s) no emulador", erros);
+        CONFERE(espera_ok, "espera do driver curta: faltavam %lu us", (unsigned long)(restante_ns / 1000));
+    }
+}
+
+int main(int argc, char **argv) {
+    imprime_quadros = argc > 1 && strcmp(argv[1], "quadros") == 0;
+
+    npInit(LED_PIN);
+    printf("Matriz %ux%u, %u LEDs\n", NUM_COLUNAS, NUM_LINHAS, LED_COUNT);
+
+    teste_alerta();
+    teste_ordem_espiral();
+    teste_espiral(NP_ANIM_ESPIRAL, false, "Espiral");
+    teste_espiral(NP_ANIM_ESPIRAL_INVERSA, true, "Espiral inversa");
+    teste_misturas();
+    teste_quadro_em_voo();
+    teste_emulador();
+
+    printf("%s: %d falha(s)\n", falhas ? "FALHOU" : "OK", falhas);
+    return falhas;
+}
@@ -0,0 +1,31 @@
+#ifndef HOST_WS2818B_PIO_H
+#define HOST_WS2818B_PIO_H
+
+// Saída do pioasm para ../ws2818b.pio (no firmware este arquivo é gerado pelo build).
+// Se o programa mudar, refazer com: pioasm ws2818b.pio ws2818b.pio.h
+
+#include "hardware/pio.h"
+
+#define ws2818b_wrap_target 0
+#define ws2818b_wrap 3
+
+static const uint16_t ws2818b_program_instructions[] = {
+            //     .wrap_target
+    0x6221, //  0: out    x, 1            side 0 [2]
+    0x1123, //  1: jmp    !x, 3           side 1 [1]
+    0x1400, //  2: jmp    0               side 1 [4]
+    0xa442, //  3: nop                    side 0 [4]
+            //     .wrap
+};
+
+static const pio_program_t ws2818b_program = {
+    .instructions = ws2818b_program_instructions,
+    .length = 4,
+    .origin = -1,
+};
+
+static inline void ws2818b_program_init(PIO pio, uint sm, uint offset, uint pin, float freq) {
+    (void)pio; (void)sm; (void)offset; (void)pin; (void)freq;
+}
+
+#endif
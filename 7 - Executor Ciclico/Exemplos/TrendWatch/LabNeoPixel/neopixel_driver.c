@@ -1,39 +1,197 @@
+#include <math.h>
 #include "neopixel_driver.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "pico/time.h"
 #include "ws2818b.pio.h"
 
 npLED_t leds[LED_COUNT];
 PIO np_pio;
 int sm;
 
+// Gerado pelo pré-processador a partir de np_geometria.h: fica em flash e nada é
+// calculado em tempo de execução
+const npIndex_t np_mapa_xy[NP_MAPA_TAMANHO] = { NP_MAPA_INICIALIZADOR };
+
+// Envio por DMA: o quadro é copiado já empacotado, então leds[] pode ser alterado logo após
+// npWriteAsync(). O quadro fica "em voo" até o DMA terminar, a FIFO esvaziar e passar o reset.
+static uint32_t quadro_dma[LED_COUNT];
+static int np_dma_chan = -1;
+static volatile bool em_voo = false;
+static npCallback_t np_callback = NULL;
+static void *np_callback_ctx = NULL;
+
+// Pipeline de cor: valor de leds[] -> gama do canal -> brilho global -> (dithering) -> byte enviado.
+// As tabelas estão em ponto fixo 8.8 (8 bits de fração): gamma_base é calculada uma vez em
+// npInit() e gamma_lut = gamma_base * brilho é refeita só quando o brilho muda. No
+// empacotamento há apenas consultas, uma multiplicação inteira opcional e deslocamentos.
+enum { CANAL_R, CANAL_G, CANAL_B };
+static uint16_t gamma_base[3][256];
+static uint16_t gamma_lut[3][256];
+static uint8_t brilho_global = 255;
+
+// Dithering temporal: a fração descartada em cada canal de cada LED é somada no quadro
+// seguinte, de modo que a média no tempo reproduz o valor 8.8 (níveis abaixo de 1 inclusive)
+static bool dither = false;
+static uint8_t resto[LED_COUNT][3];
+
+static void npCalculaGama(void) {
+    const float gama[3] = { NP_GAMMA_R, NP_GAMMA_G, NP_GAMMA_B };
+    for (int c = 0; c < 3; c++) {
+        for (int v = 0; v < 256; v++) {
+            gamma_base[c][v] = (uint16_t)(powf(v / 255.0f, gama[c]) * (255 << 8) + 0.5f);
+        }
+    }
+}
+
+// Refaz a tabela final com o brilho global (só inteiros)
+void npSetBrilho(uint8_t brilho) {
+    brilho_global = brilho;
+    for (int c = 0; c < 3; c++) {
+        for (int v = 0; v < 256; v++) {
+            gamma_lut[c][v] = (uint16_t)(((uint32_t)gamma_base[c][v] * (brilho + 1u)) >> 8);
+        }
+    }
+}
+
+void npSetDither(bool habilitado) {
+    dither = habilitado;
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        resto[i][CANAL_R] = resto[i][CANAL_G] = resto[i][CANAL_B] = 0;
+    }
+}
+
+// Byte enviado para um canal do LED `i`; `escala` (0 a 256) é um brilho extra do quadro
+static inline uint32_t npCanal(uint i, int c, uint8_t valor, uint32_t escala) {
+    uint32_t x = gamma_lut[c][valor];
+    if (escala < 256) {
+        x = (x * escala) >> 8;
+    }
+    if (dither) {
+        x += resto[i][c];
+        resto[i][c] = x & 0xFF;
+    } else {
+        x += 0x80;   // Arredondamento
+    }
+    x >>= 8;
+    return x > 255 ? 255 : x;
+}
+
+// G, R e B nos bytes altos: a PIO desloca para a esquerda e envia 24 bits por palavra
+static inline uint32_t npPack(uint i, uint32_t escala) {
+    return (npCanal(i, CANAL_G, leds[i].G, escala) << 24) |
+           (npCanal(i, CANAL_R, leds[i].R, escala) << 16) |
+           (npCanal(i, CANAL_B, leds[i].B, escala) << 8);
+}
+
+// Fim do reset: a matriz já travou o quadro e um novo envio pode começar
+static int64_t npFimDoQuadro(alarm_id_t id, void *user_data) {
+    em_voo = false;
+    if (np_callback) {
+        np_callback(np_callback_ctx);
+    }
+    return 0;
+}
+
+// O DMA terminou de alimentar a FIFO: agenda o fim do quadro para quando os LEDs
+// ainda na FIFO (e o que está no OSR) tiverem saído, mais o tempo de reset
+static void npDmaIrqHandler(void) {
+    if (np_dma_chan < 0 || !dma_channel_get_irq1_status(np_dma_chan)) {
+        return;
+    }
+    dma_channel_acknowledge_irq1(np_dma_chan);
+
+    uint restantes = pio_sm_get_tx_fifo_level(np_pio, sm) + 1;
+    add_alarm_in_us(restantes * NP_US_POR_LED + NP_RESET_US, npFimDoQuadro, NULL, true);
+}
+
+// Canal DMA escrevendo na TX FIFO da máquina de estados, no ritmo do DREQ dela
+static void npDmaInit(void) {
+    np_dma_chan = dma_claim_unused_channel(true);
+
+    dma_channel_config cfg = dma_channel_get_default_config(np_dma_chan);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, pio_get_dreq(np_pio, sm, true));
+    dma_channel_configure(np_dma_chan, &cfg, &np_pio->txf[sm], quadro_dma, LED_COUNT, false);
+
+    // DMA_IRQ_0 é exclusivo do ADC (setup.c); o NeoPixel usa a linha 1
+    dma_channel_set_irq1_enabled(np_dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_1, npDmaIrqHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+}
+
 void npInit(uint pin) {
     uint offset = pio_add_program(pio0, &ws2818b_program);
     np_pio = pio0;
     sm = 0; // Usar SM 0 fixamente
     pio_sm_claim(np_pio, sm);
     ws2818b_program_init(np_pio, sm, offset, pin, 800000.f);
+    npCalculaGama();
+    npSetBrilho(brilho_global);
+    npDmaInit();
     npClear();
 }
 
+// Envio bloqueante: uma palavra por LED (a CPU fica presa durante todo o quadro, ~750 us)
 void npWrite(void) {
+    npWait();
     for (uint i = 0; i < LED_COUNT; ++i) {
-        pio_sm_put_blocking(np_pio, sm, leds[i].G);
-        pio_sm_put_blocking(np_pio, sm, leds[i].R);
-        pio_sm_put_blocking(np_pio, sm, leds[i].B);
+        pio_sm_put_blocking(np_pio, sm, npPack(i, 256));
     }
 }
 
+// Brilho extra só deste quadro (0.0 a 1.0), convertido uma vez para inteiro
 void npWriteComBrilho(float brilho) {
+    uint32_t escala = brilho <= 0.0f ? 0 : brilho >= 1.0f ? 256 : (uint32_t)(brilho * 256.0f);
+
+    npWait();
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        pio_sm_put_blocking(np_pio, sm, npPack(i, escala));
+    }
+}
+
+// Palavras exatamente como o DMA as escreve na TX FIFO (usado também pelo emulador da PIO).
+// Com dithering ligado, cada chamada conta como um quadro enviado.
+void npEmpacota(uint32_t *quadro) {
     for (uint i = 0; i < LED_COUNT; ++i) {
-        uint8_t r = leds[i].R * brilho;
-        uint8_t g = leds[i].G * brilho;
-        uint8_t b = leds[i].B * brilho;
-        pio_sm_put_blocking(np_pio, sm, g);
-        pio_sm_put_blocking(np_pio, sm, r);
-        pio_sm_put_blocking(np_pio, sm, b);
+        quadro[i] = npPack(i, 256);
+    }
+}
+
+// Empacota leds[] e entrega o quadro ao DMA, retornando em seguida.
+// Retorna false (nada é enviado) se o quadro anterior ainda estiver em voo.
+bool npWriteAsync(void) {
+    if (em_voo) {
+        return false;
+    }
+
+    npEmpacota(quadro_dma);
+
+    em_voo = true;
+    dma_channel_transfer_from_buffer_now(np_dma_chan, quadro_dma, LED_COUNT);
+    return true;
+}
+
+// Indica se há quadro em voo (DMA, FIFO ou tempo de reset)
+bool npBusy(void) {
+    return em_voo;
+}
+
+void npWait(void) {
+    while (em_voo) {
+        tight_loop_contents();
     }
 }
 
-void npSetLED(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
+// Registra a função chamada ao fim de cada quadro assíncrono
+void npSetCallback(npCallback_t callback, void *ctx) {
+    np_callback = callback;
+    np_callback_ctx = ctx;
+}
+
+void npSetLED(npIndex_t index, uint8_t r, uint8_t g, uint8_t b) {
     if (index < LED_COUNT) {
         leds[index].R = r;
         leds[index].G = g;
@@ -41,6 +199,27 @@ void npSetLED(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
     }
 }
 
+// Fileira y inteira: percorre o trecho contíguo da tabela, sem cálculo de índice
+void npSetFileira(uint y, uint8_t r, uint8_t g, uint8_t b) {
+    if (y >= NUM_LINHAS) {
+        return;
+    }
+    const npIndex_t *mapa = &np_mapa_xy[y * NUM_COLUNAS];
+    for (uint x = 0; x < NUM_COLUNAS; ++x) {
+        leds[mapa[x]] = (npLED_t){ .G = g, .R = r, .B = b };
+    }
+}
+
+// Coluna x inteira: mesma tabela, em passos de NUM_COLUNAS
+void npSetColuna(uint x, uint8_t r, uint8_t g, uint8_t b) {
+    if (x >= NUM_COLUNAS) {
+        return;
+    }
+    for (uint k = x; k < LED_COUNT; k += NUM_COLUNAS) {
+        leds[np_mapa_xy[k]] = (npLED_t){ .G = g, .R = r, .B = b };
+    }
+}
+
 void npSetAll(uint8_t r, uint8_t g, uint8_t b) {
     for (uint i = 0; i < LED_COUNT; ++i) {
         npSetLED(i, r, g, b);
@@ -58,9 +237,7 @@ void liberar_maquina_pio(PIO pio, uint sm_id) {
     }
 }
 
-uint getLEDIndex(uint x, uint y) {
+npIndex_t getLEDIndex(uint x, uint y) {
     if (x >= NUM_COLUNAS || y >= NUM_LINHAS) return 0;
-    uint linha_fisica = NUM_LINHAS - 1 - y;
-    uint base = linha_fisica * NUM_COLUNAS;
-    return (linha_fisica % 2 == 0) ? base + (NUM_COLUNAS - 1 - x) : base + x;
+    return np_mapa_xy[y * NUM_COLUNAS + x];
 }
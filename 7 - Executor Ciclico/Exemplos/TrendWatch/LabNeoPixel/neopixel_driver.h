@@ -2,22 +2,33 @@
 #define NEOPIXEL_DRIVER_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "hardware/pio.h"
+#include "np_geometria.h"   // LED_COUNT, NUM_COLUNAS, NUM_LINHAS e o mapa (x, y) -> índice
 
-#define LED_COUNT 25
 #define LED_PIN 7
-#define NUM_COLUNAS 5
-#define NUM_LINHAS 5
 #define COR_APAGA   0
 #define COR_MIN     64
 #define COR_INTER   128
 #define COR_ALTA    192
 
+// Um LED por palavra de 32 bits (G, R, B nos bytes altos), 24 bits a 800 kHz = 30 us
+#define NP_BITS_POR_LED 24
+#define NP_US_POR_LED   30
+#define NP_RESET_US     300   // Linha em nível baixo que trava o quadro (WS2812B: > 280 us)
+
+// Correção gama por canal (1.0 = linear), aplicada ao empacotar cada LED
+#define NP_GAMMA_R 2.2f
+#define NP_GAMMA_G 2.2f
+#define NP_GAMMA_B 2.2f
 
 typedef struct {
     uint8_t G, R, B;
 } npLED_t;
 
+// Chamada ao fim de um quadro enviado por DMA (já com o tempo de reset), em contexto de IRQ
+typedef void (*npCallback_t)(void *ctx);
+
 extern npLED_t leds[LED_COUNT];
 extern PIO np_pio;
 extern int sm;
@@ -25,10 +36,19 @@ extern int sm;
 void npInit(uint pin);
 void npWrite(void);
 void npWriteComBrilho(float brilho);
-void npSetLED(uint8_t index, uint8_t r, uint8_t g, uint8_t b);
+bool npWriteAsync(void);
+void npEmpacota(uint32_t *quadro);
+bool npBusy(void);
+void npWait(void);
+void npSetCallback(npCallback_t callback, void *ctx);
+void npSetBrilho(uint8_t brilho);
+void npSetDither(bool habilitado);
+void npSetLED(npIndex_t index, uint8_t r, uint8_t g, uint8_t b);
+void npSetFileira(uint y, uint8_t r, uint8_t g, uint8_t b);
+void npSetColuna(uint x, uint8_t r, uint8_t g, uint8_t b);
 void npSetAll(uint8_t r, uint8_t g, uint8_t b);
 void npClear(void);
 void liberar_maquina_pio(PIO pio, uint sm);
-uint getLEDIndex(uint x, uint y);
+npIndex_t getLEDIndex(uint x, uint y);
 
 #endif
\ No newline at end of file
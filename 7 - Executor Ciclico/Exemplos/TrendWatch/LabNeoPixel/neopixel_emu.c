@@ -0,0 +1,20 @@
+#include "neopixel_driver.h"
+#include "neopixel_emu.h"
+#include "ws2818b.pio.h"
+
+// Configuração do emulador equivalente a ws2818b_program_init(..., 800000) com `clk_sys_hz`
+void npEmuConfig(ws2818b_emu_config_t *cfg, uint32_t clk_sys_hz) {
+    *cfg = (ws2818b_emu_config_t){
+        .instrucoes = ws2818b_program_instructions,
+        .tamanho = sizeof(ws2818b_program_instructions) / sizeof(ws2818b_program_instructions[0]),
+        .wrap_target = ws2818b_wrap_target,
+        .wrap = ws2818b_wrap,
+        .sideset_bits = 1,
+        .sideset_opcional = false,
+        .out_para_direita = false,
+        .limiar_pull = NP_BITS_POR_LED,
+        .profundidade_fifo = 8,
+        .clk_sys_hz = clk_sys_hz,
+    };
+    ws2818b_emu_clkdiv(cfg, clk_sys_hz / (10.f * 800000.f));
+}
@@ -0,0 +1,13 @@
+#ifndef NEOPIXEL_EMU_H
+#define NEOPIXEL_EMU_H
+
+#include <stdint.h>
+#include "ws2818b_emu.h"
+
+// Ponte entre o driver e o emulador da PIO (ws2818b_emu.c): só para testes, o driver não
+// depende deste arquivo. O quadro a emular vem de npEmpacota() (neopixel_driver.h).
+// Usado por teste_emulador_neopixel() na placa e por host/teste_neopixel_host.c no PC.
+
+void npEmuConfig(ws2818b_emu_config_t *cfg, uint32_t clk_sys_hz);
+
+#endif
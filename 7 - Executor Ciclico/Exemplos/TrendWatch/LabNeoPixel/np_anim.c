@@ -0,0 +1,241 @@
+#include <string.h>
+#include <stdlib.h>
+#include "neopixel_driver.h"
+#include "efeitos.h"
+#include "np_anim.h"
+
+typedef struct {
+    bool ativa;
+    np_anim_efeito_t efeito;
+    np_anim_mistura_t mistura;
+    uint8_t r, g, b;
+    uint16_t passo_ms;
+    uint8_t repeticoes;         // 0 = sem fim
+    absolute_time_t inicio;
+} np_anim_camada_t;
+
+static np_anim_camada_t camadas[NP_ANIM_CAMADAS];
+static npLED_t quadro_camada[LED_COUNT];
+static uint32_t intervalo_us = 1000000 / NP_ANIM_FPS;
+static absolute_time_t ultimo_quadro;
+
+// Passos de uma execução completa de cada efeito
+static uint32_t passos_do_efeito(np_anim_efeito_t efeito) {
+    switch (efeito) {
+        case NP_ANIM_PISCA:                 return 2;
+        case NP_ANIM_ESPIRAL:
+        case NP_ANIM_ESPIRAL_INVERSA:       return LED_COUNT;
+        case NP_ANIM_ONDA_VERTICAL:         return NUM_LINHAS + 3;
+        case NP_ANIM_ONDA_VERTICAL_BRILHO:
+        case NP_ANIM_FILEIRAS:
+        case NP_ANIM_FILEIRAS_REVERSO:      return NUM_LINHAS;
+        case NP_ANIM_COLUNAS:
+        case NP_ANIM_COLUNAS_REVERSO:       return NUM_COLUNAS;
+        default:                            return 1;
+    }
+}
+
+// Cor da camada escalada por num/den (só inteiros)
+static inline npLED_t cor_escalada(const np_anim_camada_t *c, uint num, uint den) {
+    return (npLED_t){ .G = c->g * num / den, .R = c->r * num / den, .B = c->b * num / den };
+}
+
+// Fileiras e colunas percorrem np_mapa_xy direto, com a cor calculada uma vez
+static void pinta_fileira(const np_anim_camada_t *c, uint y, uint num, uint den) {
+    npLED_t cor = cor_escalada(c, num, den);
+    const npIndex_t *mapa = &np_mapa_xy[y * NUM_COLUNAS];
+    for (uint x = 0; x < NUM_COLUNAS; x++) {
+        quadro_camada[mapa[x]] = cor;
+    }
+}
+
+static void pinta_coluna(const np_anim_camada_t *c, uint x, uint num, uint den) {
+    npLED_t cor = cor_escalada(c, num, den);
+    for (uint k = x; k < LED_COUNT; k += NUM_COLUNAS) {
+        quadro_camada[np_mapa_xy[k]] = cor;
+    }
+}
+
+// Desenha em quadro_camada o passo `passo` do efeito da camada
+static void desenha_passo(const np_anim_camada_t *c, uint32_t passo) {
+    memset(quadro_camada, 0, sizeof(quadro_camada));
+
+    switch (c->efeito) {
+        case NP_ANIM_COR_FIXA:
+            for (uint i = 0; i < LED_COUNT; i++) {
+                quadro_camada[i] = (npLED_t){ .G = c->g, .R = c->r, .B = c->b };
+            }
+            break;
+
+        case NP_ANIM_PISCA:
+            if (passo == 0) {
+                for (uint i = 0; i < LED_COUNT; i++) {
+                    quadro_camada[i] = (npLED_t){ .G = c->g, .R = c->r, .B = c->b };
+                }
+            }
+            break;
+
+        case NP_ANIM_ESPIRAL:
+        case NP_ANIM_ESPIRAL_INVERSA: {
+            // A inversa percorre a mesma ordem do fim para o começo
+            const npIndex_t *ordem = ordemEspiral();
+            npLED_t cor = cor_escalada(c, 1, 1);
+            for (uint i = 0; i <= passo; i++) {
+                quadro_camada[c->efeito == NP_ANIM_ESPIRAL ? ordem[i] : ordem[LED_COUNT - 1 - i]] = cor;
+            }
+            break;
+        }
+
+        case NP_ANIM_ONDA_VERTICAL:
+            // Intensidade 1 - 0,25 * |fase - y|
+            for (uint y = 0; y < NUM_LINHAS; y++) {
+                int distancia = abs((int)passo - (int)y);
+                if (distancia < 4) {
+                    pinta_fileira(c, y, 4 - distancia, 4);
+                }
+            }
+            break;
+
+        case NP_ANIM_ONDA_VERTICAL_BRILHO:
+            for (uint y = 0; y <= passo; y++) {
+                pinta_fileira(c, y, y + 1, NUM_LINHAS);
+            }
+            break;
+
+        case NP_ANIM_FILEIRAS:
+            pinta_fileira(c, passo, passo + 1, NUM_LINHAS);
+            break;
+
+        case NP_ANIM_FILEIRAS_REVERSO:
+            pinta_fileira(c, NUM_LINHAS - 1 - passo, passo + 1, NUM_LINHAS);
+            break;
+
+        case NP_ANIM_COLUNAS:
+            pinta_coluna(c, passo, passo + 1, NUM_COLUNAS);
+            break;
+
+        case NP_ANIM_COLUNAS_REVERSO:
+            pinta_coluna(c, NUM_COLUNAS - 1 - passo, passo + 1, NUM_COLUNAS);
+            break;
+    }
+}
+
+static inline uint8_t soma_saturada(uint8_t a, uint8_t b) {
+    uint16_t s = a + b;
+    return s > 255 ? 255 : s;
+}
+
+// Combina quadro_camada sobre leds[]
+static void mistura(np_anim_mistura_t modo) {
+    for (uint i = 0; i < LED_COUNT; i++) {
+        const npLED_t *src = &quadro_camada[i];
+        npLED_t *dst = &leds[i];
+
+        switch (modo) {
+            case NP_MISTURA_SUBSTITUI:
+                if (src->R | src->G | src->B) {
+                    *dst = *src;
+                }
+                break;
+            case NP_MISTURA_SOMA:
+                dst->R = soma_saturada(dst->R, src->R);
+                dst->G = soma_saturada(dst->G, src->G);
+                dst->B = soma_saturada(dst->B, src->B);
+                break;
+            case NP_MISTURA_MAX:
+                if (src->R > dst->R) dst->R = src->R;
+                if (src->G > dst->G) dst->G = src->G;
+                if (src->B > dst->B) dst->B = src->B;
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Define a taxa de quadros e desativa todas as camadas.
+ */
+void np_anim_init(uint8_t fps) {
+    intervalo_us = 1000000 / (fps ? fps : 1);
+    ultimo_quadro = nil_time;
+    memset(camadas, 0, sizeof(camadas));
+}
+
+/**
+ * @brief Inicia um efeito em uma camada, a partir do passo 0.
+ *
+ * @param passo_ms    Duração de cada passo (o antigo delay_ms de efeitos.c)
+ * @param repeticoes  Execuções completas antes de a camada se desligar (0 = sem fim)
+ */
+void np_anim_inicia(uint8_t camada, np_anim_efeito_t efeito, uint8_t r, uint8_t g, uint8_t b,
+                    uint16_t passo_ms, np_anim_mistura_t mistura, uint8_t repeticoes) {
+    if (camada >= NP_ANIM_CAMADAS) {
+        return;
+    }
+
+    camadas[camada] = (np_anim_camada_t){
+        .ativa = true,
+        .efeito = efeito,
+        .mistura = mistura,
+        .r = r, .g = g, .b = b,
+        .passo_ms = passo_ms ? passo_ms : 1,
+        .repeticoes = repeticoes,
+        .inicio = get_absolute_time(),
+    };
+}
+
+// Troca a cor sem reiniciar o efeito
+void np_anim_cor(uint8_t camada, uint8_t r, uint8_t g, uint8_t b) {
+    if (camada < NP_ANIM_CAMADAS) {
+        camadas[camada].r = r;
+        camadas[camada].g = g;
+        camadas[camada].b = b;
+    }
+}
+
+void np_anim_para(uint8_t camada) {
+    if (camada < NP_ANIM_CAMADAS) {
+        camadas[camada].ativa = false;
+    }
+}
+
+bool np_anim_ativa(uint8_t camada) {
+    return camada < NP_ANIM_CAMADAS && camadas[camada].ativa;
+}
+
+/**
+ * @brief Avança as animações até `agora` e envia no máximo um quadro.
+ *
+ * Não espera: retorna false se ainda não passou o intervalo do FPS ou se o quadro
+ * anterior ainda está em voo no DMA. Retorna true quando um quadro foi enviado.
+ */
+bool np_anim_tick(absolute_time_t agora) {
+    if (!is_nil_time(ultimo_quadro) && absolute_time_diff_us(ultimo_quadro, agora) < (int64_t)intervalo_us) {
+        return false;
+    }
+    if (npBusy()) {
+        return false;
+    }
+
+    memset(leds, 0, sizeof(leds));
+
+    for (uint i = 0; i < NP_ANIM_CAMADAS; i++) {
+        np_anim_camada_t *c = &camadas[i];
+        if (!c->ativa) {
+            continue;
+        }
+
+        uint32_t passos = passos_do_efeito(c->efeito);
+        int64_t decorrido_us = absolute_time_diff_us(c->inicio, agora);
+        uint32_t passo = decorrido_us > 0 ? (uint32_t)(decorrido_us / 1000) / c->passo_ms : 0;
+        if (c->repeticoes && passo >= passos * c->repeticoes) {
+            c->ativa = false;   // Terminou: a camada some a partir deste quadro
+            continue;
+        }
+
+        desenha_passo(c, passo % passos);
+        mistura(c->mistura);
+    }
+
+    ultimo_quadro = agora;
+    return npWriteAsync();
+}
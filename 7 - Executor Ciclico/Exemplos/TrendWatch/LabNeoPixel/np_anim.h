@@ -0,0 +1,45 @@
+#ifndef NP_ANIM_H
+#define NP_ANIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/time.h"
+
+// Motor de animação da matriz sem esperas: cada camada guarda o efeito, a cor e o instante
+// de início; o quadro é função apenas do tempo decorrido (passo = tempo / passo_ms).
+// np_anim_tick() monta no máximo um quadro por chamada, respeitando o FPS, e o envia por
+// DMA (npWriteAsync). Camadas de índice maior ficam por cima.
+// No PC, com tempo simulado: host/teste_neopixel_host.c.
+
+#define NP_ANIM_CAMADAS 4
+#define NP_ANIM_FPS 30   // Taxa de quadros padrão
+
+typedef enum {
+    NP_ANIM_COR_FIXA,               // Matriz inteira na cor (1 passo)
+    NP_ANIM_PISCA,                  // Aceso por um passo, apagado no seguinte
+    NP_ANIM_ESPIRAL,                // Mesmos desenhos de efeitos.c
+    NP_ANIM_ESPIRAL_INVERSA,
+    NP_ANIM_ONDA_VERTICAL,
+    NP_ANIM_ONDA_VERTICAL_BRILHO,
+    NP_ANIM_FILEIRAS,
+    NP_ANIM_FILEIRAS_REVERSO,
+    NP_ANIM_COLUNAS,
+    NP_ANIM_COLUNAS_REVERSO
+} np_anim_efeito_t;
+
+// Como a camada se combina com as de baixo
+typedef enum {
+    NP_MISTURA_SUBSTITUI,   // LEDs acesos da camada cobrem os de baixo; apagados são transparentes
+    NP_MISTURA_SOMA,        // Soma por canal, saturando em 255
+    NP_MISTURA_MAX          // Maior valor por canal
+} np_anim_mistura_t;
+
+void np_anim_init(uint8_t fps);
+void np_anim_inicia(uint8_t camada, np_anim_efeito_t efeito, uint8_t r, uint8_t g, uint8_t b,
+                    uint16_t passo_ms, np_anim_mistura_t mistura, uint8_t repeticoes);
+void np_anim_cor(uint8_t camada, uint8_t r, uint8_t g, uint8_t b);
+void np_anim_para(uint8_t camada);
+bool np_anim_ativa(uint8_t camada);
+bool np_anim_tick(absolute_time_t agora);
+
+#endif
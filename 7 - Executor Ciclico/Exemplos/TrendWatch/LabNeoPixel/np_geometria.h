@@ -0,0 +1,116 @@
+#ifndef NP_GEOMETRIA_H
+#define NP_GEOMETRIA_H
+
+#include <stdint.h>
+
+// Geometria da matriz: um ou mais painéis iguais encadeados, descritos só por constantes.
+// Todas podem ser trocadas na compilação (ex.: target_compile_definitions no CMakeLists)
+// sem editar o driver. O padrão é a matriz 5x5 da BitDogLab.
+//
+// Dentro de um painel a cadeia percorre as linhas físicas a partir da de baixo
+// (NP_ORIGEM_EMBAIXO) ou da de cima; a primeira linha vai da direita para a esquerda
+// quando NP_LINHA0_INVERTIDA, e com NP_SERPENTINA cada linha seguinte inverte o sentido.
+// Os painéis são encadeados em ordem de leitura: da esquerda para a direita, de cima
+// para baixo. NP_ROTACAO gira as coordenadas lógicas (x, y) em relação ao conjunto físico.
+
+#ifndef NP_PAINEL_LARGURA
+#define NP_PAINEL_LARGURA 5
+#endif
+#ifndef NP_PAINEL_ALTURA
+#define NP_PAINEL_ALTURA 5
+#endif
+#ifndef NP_PAINEIS_X
+#define NP_PAINEIS_X 1          // Painéis lado a lado
+#endif
+#ifndef NP_PAINEIS_Y
+#define NP_PAINEIS_Y 1          // Painéis empilhados
+#endif
+#ifndef NP_ORIGEM_EMBAIXO
+#define NP_ORIGEM_EMBAIXO 1
+#endif
+#ifndef NP_LINHA0_INVERTIDA
+#define NP_LINHA0_INVERTIDA 1
+#endif
+#ifndef NP_SERPENTINA
+#define NP_SERPENTINA 1
+#endif
+#ifndef NP_ROTACAO
+#define NP_ROTACAO 0            // 0, 90, 180 ou 270 graus (sentido horário)
+#endif
+
+#define NP_LEDS_POR_PAINEL (NP_PAINEL_LARGURA * NP_PAINEL_ALTURA)
+#define NP_FIS_LARGURA (NP_PAINEL_LARGURA * NP_PAINEIS_X)
+#define NP_FIS_ALTURA  (NP_PAINEL_ALTURA * NP_PAINEIS_Y)
+
+// Dimensões lógicas: com 90 e 270 graus a largura e a altura trocam de lugar
+#if NP_ROTACAO == 0 || NP_ROTACAO == 180
+#define NUM_COLUNAS NP_FIS_LARGURA
+#define NUM_LINHAS  NP_FIS_ALTURA
+#elif NP_ROTACAO == 90 || NP_ROTACAO == 270
+#define NUM_COLUNAS NP_FIS_ALTURA
+#define NUM_LINHAS  NP_FIS_LARGURA
+#else
+#error "NP_ROTACAO deve ser 0, 90, 180 ou 270"
+#endif
+
+#define LED_COUNT (NUM_COLUNAS * NUM_LINHAS)
+
+// Índice de 16 bits: cadeias de até 65535 LEDs
+typedef uint16_t npIndex_t;
+
+#if LED_COUNT > 1024
+#error "np_mapa_xy é gerado para no máximo 1024 LEDs (ver NP_REP1024)"
+#endif
+
+// Coordenada física (px, py) da coordenada lógica (x, y)
+#if NP_ROTACAO == 0
+#define NP_FIS_X(x, y) (x)
+#define NP_FIS_Y(x, y) (y)
+#elif NP_ROTACAO == 90
+#define NP_FIS_X(x, y) (NP_FIS_LARGURA - 1 - (y))
+#define NP_FIS_Y(x, y) (x)
+#elif NP_ROTACAO == 180
+#define NP_FIS_X(x, y) (NP_FIS_LARGURA - 1 - (x))
+#define NP_FIS_Y(x, y) (NP_FIS_ALTURA - 1 - (y))
+#else
+#define NP_FIS_X(x, y) (y)
+#define NP_FIS_Y(x, y) (NP_FIS_ALTURA - 1 - (x))
+#endif
+
+// Posição na cadeia da coordenada física, em expressões constantes
+#define NP_PAINEL(px, py) (((py) / NP_PAINEL_ALTURA) * NP_PAINEIS_X + (px) / NP_PAINEL_LARGURA)
+#define NP_LINHA_NO_PAINEL(py) \
+    (NP_ORIGEM_EMBAIXO ? NP_PAINEL_ALTURA - 1 - (py) % NP_PAINEL_ALTURA : (py) % NP_PAINEL_ALTURA)
+#define NP_LINHA_INVERTIDA(l) (NP_LINHA0_INVERTIDA ^ (NP_SERPENTINA && ((l) & 1)))
+#define NP_COLUNA_NO_PAINEL(px, l) \
+    (NP_LINHA_INVERTIDA(l) ? NP_PAINEL_LARGURA - 1 - (px) % NP_PAINEL_LARGURA : (px) % NP_PAINEL_LARGURA)
+#define NP_INDICE_FIS(px, py) \
+    (NP_PAINEL(px, py) * NP_LEDS_POR_PAINEL + NP_LINHA_NO_PAINEL(py) * NP_PAINEL_LARGURA + \
+     NP_COLUNA_NO_PAINEL(px, NP_LINHA_NO_PAINEL(py)))
+#define NP_INDICE_XY(x, y) NP_INDICE_FIS(NP_FIS_X(x, y), NP_FIS_Y(x, y))
+
+// Entrada k da tabela (k = y * NUM_COLUNAS + x); entradas além de LED_COUNT ficam em 0
+#define NP_MAPA_K(k) ((k) < LED_COUNT ? NP_INDICE_XY((k) % NUM_COLUNAS, (k) / NUM_COLUNAS) : 0)
+#define NP_REP4(k)    NP_MAPA_K(k), NP_MAPA_K((k) + 1), NP_MAPA_K((k) + 2), NP_MAPA_K((k) + 3)
+#define NP_REP16(k)   NP_REP4(k), NP_REP4((k) + 4), NP_REP4((k) + 8), NP_REP4((k) + 12)
+#define NP_REP64(k)   NP_REP16(k), NP_REP16((k) + 16), NP_REP16((k) + 32), NP_REP16((k) + 48)
+#define NP_REP256(k)  NP_REP64(k), NP_REP64((k) + 64), NP_REP64((k) + 128), NP_REP64((k) + 192)
+#define NP_REP1024(k) NP_REP256(k), NP_REP256((k) + 256), NP_REP256((k) + 512), NP_REP256((k) + 768)
+
+// Tamanho da tabela: o menor degrau de repetição que cobre a matriz
+#if LED_COUNT <= 64
+#define NP_MAPA_TAMANHO 64
+#define NP_MAPA_INICIALIZADOR NP_REP64(0)
+#elif LED_COUNT <= 256
+#define NP_MAPA_TAMANHO 256
+#define NP_MAPA_INICIALIZADOR NP_REP256(0)
+#else
+#define NP_MAPA_TAMANHO 1024
+#define NP_MAPA_INICIALIZADOR NP_REP1024(0)
+#endif
+
+// Índice na cadeia de cada (x, y), linha a linha: np_mapa_xy[y * NUM_COLUNAS + x].
+// Uma fileira é um trecho contíguo; uma coluna, passos de NUM_COLUNAS.
+extern const npIndex_t np_mapa_xy[NP_MAPA_TAMANHO];
+
+#endif
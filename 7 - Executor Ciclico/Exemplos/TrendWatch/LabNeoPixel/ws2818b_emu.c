@@ -0,0 +1,312 @@
+#include <stdio.h>
+#include <string.h>
+#include "ws2818b_emu.h"
+
+// Estado da máquina de estados emulada
+typedef struct {
+    uint8_t pc;
+    uint32_t x, y;
+    uint32_t osr;
+    uint8_t contagem_osr;        // Bits já deslocados do OSR (32 = vazio após o init)
+    uint8_t atraso;              // Ciclos de atraso restantes da instrução anterior
+    uint8_t pino;
+} ws2818b_emu_sm_t;
+
+// Relógio: instante atual em ciclos de clk_sys e acumulador do divisor fracionário
+static uint64_t ciclos;
+static uint16_t acumulador_frac;
+
+static uint32_t ns(const ws2818b_emu_config_t *cfg, uint64_t c) {
+    return (uint32_t)(c * 1000000000ull / cfg->clk_sys_hz);
+}
+
+// Avança um ciclo da máquina de estados: clkdiv_int ciclos de clk_sys, mais um quando a
+// parte fracionária acumulada passa de 1
+static void avanca(const ws2818b_emu_config_t *cfg) {
+    ciclos += cfg->clkdiv_int ? cfg->clkdiv_int : 65536;
+    acumulador_frac += cfg->clkdiv_frac;
+    if (acumulador_frac >= 256) {
+        acumulador_frac -= 256;
+        ciclos++;
+    }
+}
+
+// Converte o divisor em float como sm_config_set_clkdiv()
+void ws2818b_emu_clkdiv(ws2818b_emu_config_t *cfg, float divisor) {
+    cfg->clkdiv_int = (uint16_t)divisor;
+    cfg->clkdiv_frac = (uint8_t)((divisor - cfg->clkdiv_int) * 256.0f);
+}
+
+// Decodificação da forma de onda e conferência das faixas
+typedef struct {
+    const ws2818b_emu_config_t *cfg;
+    const uint32_t *grb;
+    size_t leds;
+    ws2818b_emu_resultado_t *r;
+    ws2818b_emu_borda_t *bordas;
+    size_t max_bordas, n_bordas;
+    uint64_t subida, descida;
+    bool primeira_subida;
+} ws2818b_emu_onda_t;
+
+// Bit `n` que os LEDs devem receber: 24 por LED, G7 primeiro e B0 por último
+static bool bit_esperado(const ws2818b_emu_onda_t *o, uint32_t n) {
+    return (o->grb[n / 24] >> (23 - n % 24)) & 1;
+}
+
+static void faixa(uint32_t v, uint32_t *min, uint32_t *max) {
+    if (v < *min) *min = v;
+    if (v > *max) *max = v;
+}
+
+static void borda(ws2818b_emu_onda_t *o, uint8_t nivel) {
+    ws2818b_emu_resultado_t *r = o->r;
+
+    if (o->n_bordas < o->max_bordas) {
+        o->bordas[o->n_bordas] = (ws2818b_emu_borda_t){ ns(o->cfg, ciclos), nivel };
+    }
+    o->n_bordas++;
+
+    if (nivel) {
+        if (o->primeira_subida) {
+            uint32_t tl = ns(o->cfg, ciclos - o->descida);
+            faixa(tl, &r->tl_min_ns, &r->tl_max_ns);
+            if (tl < WS2812_TL_MIN_NS || tl > WS2812_TL_MAX_NS) r->violacoes++;
+        }
+        o->primeira_subida = true;
+        o->subida = ciclos;
+        return;
+    }
+
+    // Descida: a largura do pulso alto define o bit (limiar no meio entre T0H e T1H)
+    uint32_t th = ns(o->cfg, ciclos - o->subida);
+    bool um = th > (WS2812_T0H_MAX_NS + WS2812_T1H_MIN_NS) / 2;
+    if (um) {
+        faixa(th, &r->t1h_min_ns, &r->t1h_max_ns);
+        if (th < WS2812_T1H_MIN_NS || th > WS2812_T1H_MAX_NS) r->violacoes++;
+    } else {
+        faixa(th, &r->t0h_min_ns, &r->t0h_max_ns);
+        if (th < WS2812_T0H_MIN_NS || th > WS2812_T0H_MAX_NS) r->violacoes++;
+    }
+    if (o->grb && (r->bits >= o->leds * 24 || um != bit_esperado(o, r->bits))) {
+        r->bits_errados++;
+    }
+    r->bits++;
+    o->descida = ciclos;
+}
+
+static void aplica_sideset(ws2818b_emu_onda_t *o, ws2818b_emu_sm_t *s, uint16_t instr) {
+    const ws2818b_emu_config_t *cfg = o->cfg;
+    if (!cfg->sideset_bits) {
+        return;
+    }
+
+    uint8_t campo = (instr >> 8) & 0x1F;
+    uint8_t valor = campo >> (5 - cfg->sideset_bits);
+    if (cfg->sideset_opcional) {
+        if (!(valor >> (cfg->sideset_bits - 1))) {
+            return;   // Bit de habilitação em 0: pino mantém o nível
+        }
+        valor &= (1u << (cfg->sideset_bits - 1)) - 1;
+    }
+
+    uint8_t nivel = valor & 1;   // Só o primeiro pino de side-set importa aqui
+    if (nivel != s->pino) {
+        s->pino = nivel;
+        borda(o, nivel);
+    }
+}
+
+static uint8_t atraso_da(const ws2818b_emu_config_t *cfg, uint16_t instr) {
+    uint8_t bits_atraso = 5 - cfg->sideset_bits;
+    return ((instr >> 8) & 0x1F) & ((1u << bits_atraso) - 1);
+}
+
+/**
+ * Executa o programa até a máquina parar com a FIFO vazia depois da última palavra.
+ *
+ * @param quadro      Palavras como o DMA as escreve na TX FIFO (npEmpacota())
+ * @param grb         Cor que cada LED deve receber (0xGGRRBB), ou NULL para não conferir bits
+ * @param reset_us    Tempo em nível baixo entre quadros usado pelo driver (NP_RESET_US)
+ * @param bordas      Buffer opcional para a forma de onda (NULL para só conferir);
+ *                    `*n_bordas` recebe o total de bordas, mesmo além de `max_bordas`
+ * @return 0 se o quadro foi transmitido sem erros e dentro das faixas; < 0 com erro de
+ *         execução; > 0 com o número de bits errados mais o de violações de tempo
+ */
+int ws2818b_emu_run(const ws2818b_emu_config_t *cfg, const uint32_t *quadro, size_t palavras,
+                    const uint32_t *grb, size_t leds, uint32_t reset_us, ws2818b_emu_borda_t *bordas, size_t max_bordas,
+                    size_t *n_bordas, ws2818b_emu_resultado_t *r) {
+    memset(r, 0, sizeof(*r));
+    r->t0h_min_ns = r->t1h_min_ns = r->tl_min_ns = UINT32_MAX;
+    r->reset_us = reset_us;
+
+    ws2818b_emu_onda_t o = {
+        .cfg = cfg, .grb = grb, .leds = leds, .r = r,
+        .bordas = bordas, .max_bordas = bordas ? max_bordas : 0,
+    };
+    ws2818b_emu_sm_t s = { .pc = cfg->wrap_target, .contagem_osr = 32 };
+    ciclos = 0;
+    acumulador_frac = 0;
+
+    // FIFO alimentada pelo DMA: entra uma palavra assim que abre espaço
+    size_t entregues = palavras < cfg->profundidade_fifo ? palavras : cfg->profundidade_fifo;
+    size_t consumidas = 0;
+    if (entregues == palavras) {
+        r->nivel_fifo = (uint8_t)palavras;
+    }
+
+    uint64_t limite = 64 + (uint64_t)palavras * cfg->limiar_pull * 64;   // Ciclos da SM
+    uint64_t passos = 0;
+
+    for (;; avanca(cfg)) {
+        if (++passos > limite) {
+            r->erro = WS2818B_EMU_ERRO_TEMPO;
+            break;
+        }
+        if (s.atraso) {
+            s.atraso--;
+            continue;
+        }
+        if (s.pc >= cfg->tamanho) {
+            r->erro = WS2818B_EMU_ERRO_INSTRUCAO;
+            break;
+        }
+
+        uint16_t instr = cfg->instrucoes[s.pc];
+        uint8_t proximo = (s.pc == cfg->wrap) ? cfg->wrap_target : s.pc + 1;
+        aplica_sideset(&o, &s, instr);
+
+        switch (instr >> 13) {
+            case 0: {   // JMP
+                uint8_t cond = (instr >> 5) & 0x07;
+                bool salta;
+                switch (cond) {
+                    case 0: salta = true; break;
+                    case 1: salta = s.x == 0; break;
+                    case 2: salta = s.x-- != 0; break;
+                    case 3: salta = s.y == 0; break;
+                    case 4: salta = s.y-- != 0; break;
+                    case 5: salta = s.x != s.y; break;
+                    case 7: salta = (s.contagem_osr < cfg->limiar_pull); break;   // !OSRE
+                    default:
+                        r->erro = WS2818B_EMU_ERRO_INSTRUCAO;
+                        goto fim;
+                }
+                if (salta) {
+                    proximo = instr & 0x1F;
+                }
+                break;
+            }
+
+            case 3: {   // OUT
+                uint8_t destino = (instr >> 5) & 0x07;
+                uint8_t n = instr & 0x1F ? instr & 0x1F : 32;
+
+                if (s.contagem_osr >= cfg->limiar_pull) {
+                    if (consumidas == palavras) {
+                        // FIFO vazia com o quadro inteiro enviado: parada no autopull
+                        // (o side-set desta instrução já foi aplicado)
+                        r->duracao_ns = ns(cfg, ciclos);
+                        goto fim;
+                    }
+                    s.osr = quadro[consumidas++];
+                    s.contagem_osr = 0;
+                    if (entregues < palavras) {
+                        entregues++;
+                        if (entregues == palavras) {
+                            r->t_ultimo_push_ns = ns(cfg, ciclos);
+                            r->nivel_fifo = (uint8_t)(entregues - consumidas);
+                        }
+                    }
+                }
+
+                uint32_t dado;
+                if (cfg->out_para_direita) {
+                    dado = n == 32 ? s.osr : s.osr & ((1u << n) - 1);
+                    s.osr = n == 32 ? 0 : s.osr >> n;
+                } else {
+                    dado = n == 32 ? s.osr : s.osr >> (32 - n);
+                    s.osr = n == 32 ? 0 : s.osr << n;
+                }
+                s.contagem_osr = (s.contagem_osr + n > 32) ? 32 : s.contagem_osr + n;
+
+                switch (destino) {
+                    case 1: s.x = dado; break;
+                    case 2: s.y = dado; break;
+                    case 3: break;      // null
+                    default:
+                        r->erro = WS2818B_EMU_ERRO_INSTRUCAO;
+                        goto fim;
+                }
+                break;
+            }
+
+            case 5: {   // MOV entre x, y e null (nop = mov y, y)
+                uint8_t destino = (instr >> 5) & 0x07;
+                uint8_t origem = instr & 0x07;
+                uint8_t op = (instr >> 3) & 0x03;
+                uint32_t v = origem == 1 ? s.x : origem == 2 ? s.y : 0;
+                if (origem == 0 || origem > 3 || op > 1) {
+                    r->erro = WS2818B_EMU_ERRO_INSTRUCAO;
+                    goto fim;
+                }
+                if (op == 1) v = ~v;
+                if (destino == 1) s.x = v;
+                else if (destino == 2) s.y = v;
+                else {
+                    r->erro = WS2818B_EMU_ERRO_INSTRUCAO;
+                    goto fim;
+                }
+                break;
+            }
+
+            default:
+                r->erro = WS2818B_EMU_ERRO_INSTRUCAO;
+                goto fim;
+        }
+
+        s.atraso = atraso_da(cfg, instr);
+        s.pc = proximo;
+    }
+
+fim:
+    if (n_bordas) {
+        *n_bordas = o.n_bordas;
+    }
+    if (r->erro) {
+        return r->erro;
+    }
+    if (reset_us < WS2812_RESET_MIN_US || s.pino) {
+        r->erro = WS2818B_EMU_ERRO_RESET;   // Reset curto ou linha parada em nível alto
+        return r->erro;
+    }
+
+    r->quadros_por_s = 1e9f / ((float)r->duracao_ns + reset_us * 1000.0f);
+    uint32_t esperados = grb ? (uint32_t)leds * 24 : 0;
+    uint32_t faltando = r->bits < esperados ? esperados - r->bits : 0;
+    return (int)(r->bits_errados + faltando + r->violacoes);
+}
+
+void ws2818b_emu_imprime(const ws2818b_emu_resultado_t *r) {
+    if (r->erro) {
+        printf("[WS2818B EMU] erro %d\n", r->erro);
+        return;
+    }
+    printf("[WS2818B EMU] %lu bits, %lu errados, %lu violações\n",
+           (unsigned long)r->bits, (unsigned long)r->bits_errados, (unsigned long)r->violacoes);
+    if (r->t0h_min_ns != UINT32_MAX) {
+        printf("  T0H %lu-%lu ns (%d-%d)\n", (unsigned long)r->t0h_min_ns, (unsigned long)r->t0h_max_ns,
+               WS2812_T0H_MIN_NS, WS2812_T0H_MAX_NS);
+    }
+    if (r->t1h_min_ns != UINT32_MAX) {
+        printf("  T1H %lu-%lu ns (%d-%d)\n", (unsigned long)r->t1h_min_ns, (unsigned long)r->t1h_max_ns,
+               WS2812_T1H_MIN_NS, WS2812_T1H_MAX_NS);
+    }
+    if (r->tl_min_ns != UINT32_MAX) {
+        printf("  TL  %lu-%lu ns (%d-%d)\n", (unsigned long)r->tl_min_ns, (unsigned long)r->tl_max_ns,
+               WS2812_TL_MIN_NS, WS2812_TL_MAX_NS);
+    }
+    printf("  quadro %lu us + reset %lu us = %.1f quadros/s; último push em %lu us com %u na FIFO\n",
+           (unsigned long)(r->duracao_ns / 1000), (unsigned long)r->reset_us, r->quadros_por_s,
+           (unsigned long)(r->t_ultimo_push_ns / 1000), r->nivel_fifo);
+}
@@ -0,0 +1,88 @@
+#ifndef WS2818B_EMU_H
+#define WS2818B_EMU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Emulador de uma máquina de estados PIO executando ws2818b.pio, ciclo a ciclo.
+// Cobre o subconjunto usado pelo programa: OUT (x, y, null), JMP (todas as condições
+// exceto pino), MOV entre x/y (nop), side-set com ou sem opcional, atrasos, wrap, divisor
+// de clock fracionário e autopull com limiar e sentido de deslocamento. O programa fica
+// no endereço 0, como sai do pioasm (antes da relocação feita por pio_add_program()).
+// A TX FIFO é mantida cheia com as palavras do quadro, como faz o DMA (npWriteAsync).
+//
+// A saída é a forma de onda do pino de side-set (bordas com instante em ns), decodificada
+// de volta em bits e comparada com as cores que cada LED deve receber (G, R, B, MSB primeiro). Os pulsos altos são conferidos contra as
+// faixas do WS2812B; no nível baixo só importa não passar do tempo que trava o quadro.
+// Usa apenas a biblioteca C padrão, sem o Pico SDK.
+
+// Faixas do datasheet WS2812B-V5 (ns), podem ser trocadas na compilação
+#ifndef WS2812_T0H_MIN_NS
+#define WS2812_T0H_MIN_NS 220
+#endif
+#ifndef WS2812_T0H_MAX_NS
+#define WS2812_T0H_MAX_NS 380
+#endif
+#ifndef WS2812_T1H_MIN_NS
+#define WS2812_T1H_MIN_NS 580
+#endif
+#ifndef WS2812_T1H_MAX_NS
+#define WS2812_T1H_MAX_NS 1000
+#endif
+#ifndef WS2812_TL_MIN_NS
+#define WS2812_TL_MIN_NS 220       // Nível baixo mais curto que o LED ainda enxerga
+#endif
+#ifndef WS2812_TL_MAX_NS
+#define WS2812_TL_MAX_NS 5000      // Acima disso alguns lotes já travam o quadro
+#endif
+#ifndef WS2812_RESET_MIN_US
+#define WS2812_RESET_MIN_US 280
+#endif
+
+// Programa e configuração da máquina de estados (o que ws2818b_program_init() ajusta)
+typedef struct {
+    const uint16_t *instrucoes;
+    uint8_t tamanho;
+    uint8_t wrap_target, wrap;
+    uint8_t sideset_bits;        // Bits de side-set (incluindo o de habilitação se opcional)
+    bool sideset_opcional;
+    bool out_para_direita;       // false: OSR desloca para a esquerda (MSB primeiro)
+    uint8_t limiar_pull;         // Bits por palavra antes do autopull (1 a 32)
+    uint8_t profundidade_fifo;   // 4, ou 8 com FIFO_JOIN_TX
+    uint16_t clkdiv_int;
+    uint8_t clkdiv_frac;         // Em 1/256
+    uint32_t clk_sys_hz;
+} ws2818b_emu_config_t;
+
+typedef struct {
+    uint32_t t_ns;
+    uint8_t nivel;
+} ws2818b_emu_borda_t;
+
+typedef struct {
+    int erro;                    // 0 = ok; < 0 ver WS2818B_EMU_ERRO_*
+    uint32_t bits;               // Pulsos altos decodificados
+    uint32_t bits_errados;       // Diferentes das cores esperadas (inclui bits a mais)
+    uint32_t violacoes;          // Pulsos fora das faixas WS2812
+    uint32_t t0h_min_ns, t0h_max_ns;
+    uint32_t t1h_min_ns, t1h_max_ns;
+    uint32_t tl_min_ns, tl_max_ns;
+    uint32_t duracao_ns;         // Até o fim do último bit (máquina parada na FIFO vazia)
+    uint32_t t_ultimo_push_ns;   // Quando a última palavra entrou na FIFO (fim do DMA)
+    uint8_t nivel_fifo;          // Palavras na FIFO nesse instante
+    uint32_t reset_us;
+    float quadros_por_s;         // Com o reset entre quadros
+} ws2818b_emu_resultado_t;
+
+#define WS2818B_EMU_ERRO_INSTRUCAO (-1)   // Instrução fora do subconjunto emulado
+#define WS2818B_EMU_ERRO_TEMPO     (-2)   // O programa não consumiu o quadro a tempo
+#define WS2818B_EMU_ERRO_RESET     (-3)   // Reset entre quadros abaixo do mínimo
+
+int ws2818b_emu_run(const ws2818b_emu_config_t *cfg, const uint32_t *quadro, size_t palavras,
+                    const uint32_t *grb, size_t leds, uint32_t reset_us, ws2818b_emu_borda_t *bordas, size_t max_bordas,
+                    size_t *n_bordas, ws2818b_emu_resultado_t *r);
+void ws2818b_emu_clkdiv(ws2818b_emu_config_t *cfg, float divisor);
+void ws2818b_emu_imprime(const ws2818b_emu_resultado_t *r);
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: agenda.h
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Tarefas do executor cíclico: nome, função, período (ms),
+ *      offset (ms) e orçamento (us). A mesma lista é expandida
+ *      em main.c (com as funções) e na ferramenta de PC de
+ *      executor_tabela.c (só os tempos).
+ *
+ *      A animação da matriz roda a 50 Hz; temperatura, análise,
+ *      display, média em blocos e relatório a 1 Hz, espalhados
+ *      pelos offsets em quadros diferentes do ciclo de 1 s. A
+ *      descarga do rastro (trace.c) roda a 5 Hz.
+ *
+ *      A Tarefa 1 é dividida em fases, todas na mesma tarefa de
+ *      20 ms: o início pega a metade do ADC assim que ela fica
+ *      pronta, a acumulação soma TEMP_TRECHO amostras por quadro
+ *      (8 quadros por metade) e a conclusão publica a média no
+ *      quadro em que a soma termina. As metades duram 1,024 s,
+ *      então a fase delas desliza 24 ms por ciclo em relação aos
+ *      quadros; presas a quadros fixos do ciclo, parte das
+ *      metades seria lida depois de o DMA voltar a elas.
+ *
+ *      O índice de cada tarefa nesta lista é o seu número nos
+ *      registros do rastro.
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#ifndef AGENDA_H
+#define AGENDA_H
+
+// 1: Tarefa 1 em fases a cada quadro (início, acumulação, conclusão);
+// 0: Tarefa 1 inteira no quadro 0, como antes (para comparar utilização e resposta)
+#ifndef TAREFA1_EM_FASES
+#define TAREFA1_EM_FASES 1
+#endif
+
+#if TAREFA1_EM_FASES
+#define AGENDA_TAREFAS(X)                                           \
+    X("anima",      tarefa_anima,      20,   0,  1000)              \
+    X("T1 fases",   tarefa_1_fases,    20,   0,   450)              \
+    X("T2 analise", tarefa_2,        1000,   0,   200)              \
+    X("T4 matriz",  tarefa_4,        1000,   0,   300)              \
+    X("T3 oled",    tarefa_3,        1000,  20,  8000)              \
+    X("T5 blocos",  tarefa_5,        1000,  40,  2000)              \
+    X("relatorio",  tarefa_relatorio, 1000, 60,  2000)              \
+    X("trace",      tarefa_trace,     200,  80,  3000)
+#else
+#define AGENDA_TAREFAS(X)                                           \
+    X("anima",      tarefa_anima,      20,   0,  1000)              \
+    X("T1 temp",    tarefa_1,        1000,   0,  2000)              \
+    X("T2 analise", tarefa_2,        1000,   0,   200)              \
+    X("T4 matriz",  tarefa_4,        1000,   0,   300)              \
+    X("T3 oled",    tarefa_3,        1000,  20,  8000)              \
+    X("T5 blocos",  tarefa_5,        1000,  40,  2000)              \
+    X("relatorio",  tarefa_relatorio, 1000, 60,  2000)              \
+    X("trace",      tarefa_trace,     200,  80,  3000)
+#endif
+
+#endif  // AGENDA_H
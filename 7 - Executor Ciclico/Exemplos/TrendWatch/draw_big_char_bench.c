@@ -0,0 +1,212 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: draw_big_char_bench.c
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Ferramenta de PC (não entra no firmware) que compara o
+ *      draw_big_char() atual (inc/draw_big_char.c, glifos no
+ *      formato de página) com o antigo, que acendia os 512
+ *      pixels de cada glifo com ssd1306_set_pixel() a partir
+ *      do bitmap linha a linha.
+ *
+ *      Os glifos antigos são reconstruídos a partir de
+ *      inc/font_big_logo_data.c. Antes de medir, confere que os
+ *      dois desenham o mesmo buffer para todos os glifos em
+ *      x = 0..112 e y = 0..32, sobre um fundo aleatório.
+ *
+ *      Depois mede o passo de desenho da tarefa 2 de
+ *      ECDeterministico e TempCycleDMA, mostrar_valor_grande()
+ *      com "+23.4oC" em y = 32 (alinhado à página), e o mesmo
+ *      texto em y = 29 (desalinhado). Imprime o tempo por
+ *      chamada antes e depois.
+ *
+ *      ssd1306_set_pixel() e ssd1306_mark_dirty() são cópias
+ *      das de inc/ssd1306_i2c.c, sem o assert. Para medir a
+ *      cópia de outro projeto, troque inc/ pela pasta inc/ dele
+ *      na linha do gcc.
+ *
+ *      O código de saída é o número de posições divergentes.
+ *
+ *      Uso (a partir de TrendWatch/):
+ *          gcc -O2 -std=gnu11 -Wall \
+ *              -I"../../../10 - MQTT/Exemplos/Atividade_5_MQTT_4/OLED_/host" -Iinc \
+ *              draw_big_char_bench.c inc/draw_big_char.c inc/big_string_drawer.c \
+ *              inc/font_big_logo_data.c -o draw_big_char_bench
+ *          ./draw_big_char_bench [repeticoes]
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "draw_big_char.h"
+#include "big_string_drawer.h"
+#include "font_big_logo.h"
+
+// Em ECDeterministico e TempCycleDMA, big_string_drawer.h só declara a função de string
+const uint8_t *get_big_bitmap(char c);
+int get_char_width(char c);
+int calc_string_width(const char *str);
+
+// ------------------------------------------------------------
+// Buffer e rastreamento de regiões modificadas (como no firmware)
+// ------------------------------------------------------------
+static uint32_t dirty_pages = 0;
+static uint8_t dirty_start_col[ssd1306_n_pages];
+static uint8_t dirty_end_col[ssd1306_n_pages];
+
+static inline void mark_dirty_span(uint8_t page, uint8_t col_start, uint8_t col_end) {
+    if (dirty_pages & (1u << page)) {
+        if (col_start < dirty_start_col[page]) dirty_start_col[page] = col_start;
+        if (col_end > dirty_end_col[page]) dirty_end_col[page] = col_end;
+    } else {
+        dirty_pages |= 1u << page;
+        dirty_start_col[page] = col_start;
+        dirty_end_col[page] = col_end;
+    }
+}
+
+void ssd1306_mark_dirty(uint8_t x_start, uint8_t y_start, uint8_t x_end, uint8_t y_end) {
+    if (x_end >= ssd1306_width) x_end = ssd1306_width - 1;
+    if (y_end >= ssd1306_height) y_end = ssd1306_height - 1;
+    if (x_start > x_end || y_start > y_end) return;
+
+    for (uint8_t page = y_start / 8; page <= y_end / 8; page++) {
+        mark_dirty_span(page, x_start, x_end);
+    }
+}
+
+// No firmware fica em outro arquivo: noinline para não favorecer o caminho antigo
+__attribute__((noinline)) void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set) {
+    int byte_idx = (y / 8) * ssd1306_width + x;
+    uint8_t byte = ssd[byte_idx];
+
+    if (set) {
+        byte |= 1 << (y % 8);
+    }
+    else {
+        byte &= ~(1 << (y % 8));
+    }
+
+    if (ssd[byte_idx] != byte) {
+        ssd[byte_idx] = byte;
+        mark_dirty_span(y / 8, x, x);
+    }
+}
+
+// ------------------------------------------------------------
+// Renderizador antigo
+// ------------------------------------------------------------
+// Bitmap antigo: 32 linhas de 2 bytes, bit 7 à esquerda
+static void glifo_antigo(const uint8_t *pagina, uint8_t *bitmap) {
+    memset(bitmap, 0, 64);
+    for (int row = 0; row < 32; row++) {
+        for (int col = 0; col < 16; col++) {
+            if ((pagina[(row / 8) * 16 + col] >> (row % 8)) & 0x01) {
+                bitmap[row * 2 + col / 8] |= 0x80 >> (col % 8);
+            }
+        }
+    }
+}
+
+static void draw_big_char_antigo(uint8_t *ssd, int x, int y, const uint8_t *bitmap) {
+    for (int row = 0; row < 32; row++) {
+        for (int col = 0; col < 16; col++) {
+            int byte_index = (row * 2) + (col / 8);
+            bool pixel = (bitmap[byte_index] >> (7 - (col % 8))) & 0x01;
+            ssd1306_set_pixel(ssd, x + col, y + row, pixel);
+        }
+    }
+}
+
+static const char caracteres[] = "0123456789+-.oC";
+static uint8_t glifos_antigos[sizeof(caracteres) - 1][64];
+
+static const uint8_t *bitmap_antigo(char c) {
+    const char *p = strchr(caracteres, c);
+    return p && c ? glifos_antigos[p - caracteres] : NULL;
+}
+
+// draw_big_string_aligned_right() com o renderizador antigo
+static void draw_big_string_antigo(uint8_t *ssd, int y, const char *str) {
+    int x = 128 - calc_string_width(str);
+    while (*str) {
+        const uint8_t *bitmap = bitmap_antigo(*str);
+        if (bitmap) {
+            draw_big_char_antigo(ssd, x, y, bitmap);
+        }
+        x += get_char_width(*str);
+        str++;
+    }
+}
+
+// ------------------------------------------------------------
+// Conferência e medição
+// ------------------------------------------------------------
+static uint8_t buffer_antigo[ssd1306_buffer_length];
+static uint8_t buffer_novo[ssd1306_buffer_length];
+
+static int confere_glifos(void) {
+    int divergentes = 0;
+
+    for (int g = 0; caracteres[g]; g++) {
+        for (int y = 0; y <= ssd1306_height - 32; y++) {
+            for (int x = 0; x <= ssd1306_width - 16; x++) {
+                for (int i = 0; i < ssd1306_buffer_length; i++) {
+                    buffer_antigo[i] = buffer_novo[i] = (uint8_t)rand();
+                }
+                draw_big_char_antigo(buffer_antigo, x, y, glifos_antigos[g]);
+                draw_big_char(buffer_novo, x, y, get_big_bitmap(caracteres[g]));
+                if (memcmp(buffer_antigo, buffer_novo, sizeof(buffer_novo)) != 0) {
+                    if (divergentes++ == 0) {
+                        printf("Divergência: '%c' em x=%d y=%d\n", caracteres[g], x, y);
+                    }
+                }
+            }
+        }
+    }
+    return divergentes;
+}
+
+static uint64_t agora_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// Tempo médio (ns) de uma chamada; o buffer é apagado a cada vez, como na troca de valor
+static double mede(void (*desenha)(uint8_t *, int, const char *), uint8_t *ssd, int y,
+                   const char *texto, int repeticoes) {
+    uint64_t inicio = agora_ns();
+    for (int i = 0; i < repeticoes; i++) {
+        memset(ssd, i & 1 ? 0xFF : 0x00, ssd1306_buffer_length);
+        desenha(ssd, y, texto);
+    }
+    return (double)(agora_ns() - inicio) / repeticoes;
+}
+
+int main(int argc, char **argv) {
+    int repeticoes = argc > 1 ? atoi(argv[1]) : 200000;
+    const char *texto = "+23.4oC";
+
+    for (int g = 0; caracteres[g]; g++) {
+        glifo_antigo(get_big_bitmap(caracteres[g]), glifos_antigos[g]);
+    }
+
+    int divergentes = confere_glifos();
+    printf("Glifos: %s (%d posições divergentes)\n\n",
+           divergentes ? "DIVERGEM" : "idênticos ao renderizador antigo", divergentes);
+
+    printf("\"%s\"        antes          depois     ganho\n", texto);
+    for (int y = 32; y >= 29; y -= 3) {
+        double antes = mede(draw_big_string_antigo, buffer_antigo, y, texto, repeticoes);
+        double depois = mede(draw_big_string_aligned_right, buffer_novo, y, texto, repeticoes);
+        printf("  y=%d     %9.1f ns   %9.1f ns   %5.1fx\n", y, antes, depois, antes / depois);
+    }
+    return divergentes;
+}
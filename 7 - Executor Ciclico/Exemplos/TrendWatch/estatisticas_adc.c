@@ -0,0 +1,114 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: estatisticas_adc.c
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementa as estatísticas inteiras sobre blocos de
+ *      códigos do ADC (ver estatisticas_adc.h).
+ *
+ *      No laço por amostra só há somas, uma multiplicação de
+ *      32 bits, comparações e o incremento de um bin: nenhuma
+ *      operação de ponto flutuante (que no RP2040 é emulada).
+ *      Os quadrados são somados em 32 bits em trechos de 256
+ *      amostras (256 * 4095^2 < 2^32) e só então passados para
+ *      o acumulador de 64 bits.
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#include <math.h>
+#include <string.h>
+#include "estatisticas_adc.h"
+
+#define TRECHO_QUAD 256
+
+void estat_adc_inicia(estat_adc_t *e, uint16_t centro) {
+    memset(e, 0, sizeof(*e));
+    e->min = 0xFFFF;
+    e->base = (centro > ESTAT_BINS / 2) ? centro - ESTAT_BINS / 2 : 0;
+}
+
+void estat_adc_acumula(estat_adc_t *e, const uint16_t *amostras, uint32_t n) {
+    uint32_t soma = e->soma;
+    uint16_t min = e->min, max = e->max;
+    uint16_t base = e->base;
+
+    while (n) {
+        uint32_t trecho = (n < TRECHO_QUAD) ? n : TRECHO_QUAD;
+        uint32_t soma_quad = 0;
+
+        for (uint32_t i = 0; i < trecho; i++) {
+            uint32_t v = amostras[i];
+            soma += v;
+            soma_quad += v * v;
+            if (v < min) min = v;
+            if (v > max) max = v;
+
+            uint32_t bin = v - base;   // Fora da janela vira um valor enorme (sem sinal)
+            if (bin < ESTAT_BINS) {
+                e->hist[bin]++;
+            } else if (v < base) {
+                e->abaixo++;
+            } else {
+                e->acima++;
+            }
+        }
+
+        e->soma_quad += soma_quad;
+        e->n += trecho;
+        amostras += trecho;
+        n -= trecho;
+    }
+
+    e->soma = soma;
+    e->min = min;
+    e->max = max;
+}
+
+float estat_adc_media(const estat_adc_t *e) {
+    return e->n ? (float)e->soma / e->n : 0.0f;
+}
+
+float estat_adc_desvio(const estat_adc_t *e) {
+    if (e->n < 2) {
+        return 0.0f;
+    }
+    // n * soma_quad - soma^2 é exato em inteiros (cabe em 64 bits para n <= 2^20)
+    uint64_t var_n2 = (uint64_t)e->n * e->soma_quad - (uint64_t)e->soma * e->soma;
+    return sqrtf((float)var_n2) / e->n;
+}
+
+uint16_t estat_adc_percentil(const estat_adc_t *e, uint8_t pct) {
+    if (e->n == 0) {
+        return 0;
+    }
+    if (pct > 100) {
+        pct = 100;
+    }
+
+    uint32_t posicao = (uint32_t)(((uint64_t)(e->n - 1) * pct) / 100);  // Posição na ordem (0 = menor)
+
+    if (posicao < e->abaixo) {
+        return e->min;
+    }
+    uint32_t acumulado = e->abaixo;
+    for (uint32_t i = 0; i < ESTAT_BINS; i++) {
+        acumulado += e->hist[i];
+        if (posicao < acumulado) {
+            return e->base + i;
+        }
+    }
+    return e->max;
+}
+
+float estat_adc_celsius(float codigo) {
+    const float conv = 3.3f / (1 << 12);  // Conversão para tensão
+    float voltage = codigo * conv;
+    return 27.0f - (voltage - 0.706f) / 0.001721f;
+}
+
+float estat_adc_celsius_delta(float codigos) {
+    return codigos * (3.3f / (1 << 12)) / 0.001721f;
+}
@@ -0,0 +1,77 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: estatisticas_adc.h
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Estatísticas de um bloco de amostras calculadas direto
+ *      sobre os códigos brutos de 12 bits do ADC, só com
+ *      aritmética inteira: contagem, soma, soma dos quadrados,
+ *      mínimo, máximo e um histograma para mediana/percentis.
+ *
+ *      A conversão para °C é linear, então é feita uma única
+ *      vez sobre o valor final (média, mediana, ...) em vez de
+ *      em cada amostra.
+ *
+ *      O histograma tem resolução de 1 código em uma janela de
+ *      ESTAT_BINS códigos ao redor de um centro (normalmente o
+ *      valor do bloco anterior); amostras fora da janela só são
+ *      contadas, e os percentis que caem nelas viram min/max.
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#ifndef ESTATISTICAS_ADC_H
+#define ESTATISTICAS_ADC_H
+
+#include <stdint.h>
+
+#define ESTAT_BINS 256         // Largura da janela do histograma (códigos)
+
+typedef struct {
+    uint32_t n;                // Amostras acumuladas (até 2^20 por bloco)
+    uint32_t soma;             // Soma dos códigos
+    uint64_t soma_quad;        // Soma dos quadrados dos códigos
+    uint16_t min, max;
+    uint16_t base;             // Código do primeiro bin do histograma
+    uint32_t abaixo, acima;    // Amostras fora da janela do histograma
+    uint32_t hist[ESTAT_BINS];
+} estat_adc_t;
+
+/**
+ * @brief Zera as estatísticas e centra a janela do histograma em `centro` (código).
+ */
+void estat_adc_inicia(estat_adc_t *e, uint16_t centro);
+
+/**
+ * @brief Acumula `n` códigos brutos no bloco.
+ */
+void estat_adc_acumula(estat_adc_t *e, const uint16_t *amostras, uint32_t n);
+
+/**
+ * @brief Média do bloco, em códigos.
+ */
+float estat_adc_media(const estat_adc_t *e);
+
+/**
+ * @brief Desvio padrão do bloco, em códigos.
+ */
+float estat_adc_desvio(const estat_adc_t *e);
+
+/**
+ * @brief Percentil `pct` (0 a 100) do bloco, em códigos; 50 é a mediana.
+ */
+uint16_t estat_adc_percentil(const estat_adc_t *e, uint8_t pct);
+
+/**
+ * @brief Converte um código (ou média de códigos) do sensor interno para °C.
+ */
+float estat_adc_celsius(float codigo);
+
+/**
+ * @brief Converte uma diferença/desvio em códigos para °C.
+ */
+float estat_adc_celsius_delta(float codigos);
+
+#endif  // ESTATISTICAS_ADC_H
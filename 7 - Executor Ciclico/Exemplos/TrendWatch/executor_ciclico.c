@@ -0,0 +1,119 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: executor_ciclico.c
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Despacho dos quadros do executor cíclico (ver
+ *      executor_ciclico.h). A interrupção do alarme só conta
+ *      os quadros abertos; as tarefas rodam no laço principal,
+ *      onde podem usar printf e esperar DMA/I2C. A entrada e a
+ *      saída de cada tarefa vão para o rastro (trace.c).
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "executor_ciclico.h"
+#include "trace.h"
+
+static const executor_tarefa_t *tarefas;
+static executor_tabela_t tabela;
+static executor_estat_t estat[EXECUTOR_MAX_TAREFAS];
+
+static repeating_timer_t alarme;
+static volatile uint32_t quadros_abertos = 0;
+static uint32_t quadros_executados = 0;
+static uint32_t quadros_atrasados = 0;
+
+static uint32_t t0_us;               // Abertura do quadro 0
+static uint32_t ocupado_us = 0;      // Tempo em tarefas no ciclo maior em curso
+static float utilizacao = 0.0f;
+
+static bool abre_quadro(repeating_timer_t *rt) {
+    quadros_abertos++;
+    return true;
+}
+
+executor_erro_t executor_inicia(const executor_tarefa_t *lista, uint32_t n) {
+    executor_erro_t erro = executor_monta_tabela(lista, n, &tabela);
+    if (erro != EXECUTOR_OK) {
+        printf("[EXECUTOR] Tabela recusada: %s (quadro %d)\n",
+               executor_erro_para_texto(erro), tabela.quadro_com_erro);
+        return erro;
+    }
+    tarefas = lista;
+    executor_imprime_tabela(tarefas, &tabela);
+
+    // Período negativo: intervalo medido entre inícios de callback, sem acumular deriva.
+    // O primeiro quadro abre já, sem esperar um período inteiro.
+    quadros_abertos = 1;
+    t0_us = time_us_32();
+    add_repeating_timer_ms(-(int32_t)tabela.quadro_ms, abre_quadro, NULL, &alarme);
+    return EXECUTOR_OK;
+}
+
+void executor_executa(void) {
+    while (true) {
+        while (quadros_executados == quadros_abertos) {
+            __wfi();
+        }
+        if (quadros_abertos - quadros_executados > 1) {
+            quadros_atrasados++;
+        }
+
+        uint32_t q = quadros_executados % tabela.n_quadros;
+        if (q == 0 && quadros_executados > 0) {
+            utilizacao = 100.0f * ocupado_us / (tabela.ciclo_maior_ms * 1000.0f);
+            ocupado_us = 0;
+        }
+        // Abertura deste quadro pelo alarme (aritmética módulo 2^32, como time_us_32)
+        uint32_t abertura = t0_us + quadros_executados * tabela.quadro_ms * 1000u;
+
+        for (uint32_t k = 0; k < tabela.n_no_quadro[q]; k++) {
+            uint32_t i = tabela.tarefas[q][k];
+
+            trace_registra((uint8_t)i, TRACE_ENTRADA);
+            uint32_t inicio = time_us_32();
+            tarefas[i].funcao();
+            uint32_t duracao = time_us_32() - inicio;
+            trace_registra((uint8_t)i, TRACE_SAIDA);
+
+            uint32_t resposta = inicio + duracao - abertura;
+            ocupado_us += duracao;
+
+            estat[i].execucoes++;
+            estat[i].ultimo_us = duracao;
+            if (duracao > estat[i].max_us) {
+                estat[i].max_us = duracao;
+            }
+            if (duracao > tarefas[i].orcamento_us) {
+                estat[i].estouros++;
+            }
+            if (resposta > estat[i].resposta_max_us) {
+                estat[i].resposta_max_us = resposta;
+            }
+        }
+
+        quadros_executados++;
+    }
+}
+
+const executor_tabela_t *executor_tabela(void) {
+    return &tabela;
+}
+
+const executor_estat_t *executor_estatisticas(uint32_t tarefa) {
+    return &estat[tarefa];
+}
+
+uint32_t executor_quadros_atrasados(void) {
+    return quadros_atrasados;
+}
+
+float executor_utilizacao(void) {
+    return utilizacao;
+}
@@ -0,0 +1,60 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: executor_ciclico.h
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Executor cíclico dirigido por tabela. Um alarme de
+ *      hardware (repeating_timer) abre cada quadro menor; o
+ *      laço principal dorme em __wfi() até lá e então executa,
+ *      fora da interrupção, as tarefas daquele quadro.
+ *
+ *      Por tarefa são medidos o tempo de execução (máximo e
+ *      último), o tempo de resposta (da abertura do quadro ao
+ *      fim da tarefa) e quantas vezes o orçamento foi
+ *      ultrapassado; por ciclo maior, a utilização (tempo em
+ *      tarefas / duração do ciclo).
+ *      Quando um quadro termina depois de o seguinte já ter
+ *      sido aberto, o executor conta o atraso e executa o
+ *      quadro seguinte em seguida, sem pular tarefas.
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#ifndef EXECUTOR_CICLICO_H
+#define EXECUTOR_CICLICO_H
+
+#include <stdint.h>
+#include "executor_tabela.h"
+
+typedef struct {
+    uint32_t execucoes;
+    uint32_t ultimo_us;
+    uint32_t max_us;
+    uint32_t estouros;           // Execuções acima do orçamento
+    uint32_t resposta_max_us;    // Abertura do quadro -> fim da tarefa (pior caso)
+} executor_estat_t;
+
+/**
+ * @brief Monta a tabela das `n` tarefas e arma o alarme do quadro menor.
+ *
+ * @return EXECUTOR_OK ou o motivo da recusa (a tabela é impressa se for aceita).
+ */
+executor_erro_t executor_inicia(const executor_tarefa_t *tarefas, uint32_t n);
+
+/**
+ * @brief Despacha os quadros para sempre (não retorna).
+ */
+void executor_executa(void);
+
+const executor_tabela_t *executor_tabela(void);
+const executor_estat_t *executor_estatisticas(uint32_t tarefa);
+uint32_t executor_quadros_atrasados(void);
+
+/**
+ * @brief Utilização do último ciclo maior completo, em porcentagem.
+ */
+float executor_utilizacao(void);
+
+#endif  // EXECUTOR_CICLICO_H
@@ -0,0 +1,159 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: executor_tabela.c
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Calcula ciclo maior, quadro menor e a tabela de quadros
+ *      do executor cíclico (ver executor_tabela.h). Compilado
+ *      com -DEXECUTOR_TABELA_HOST vira uma ferramenta de PC que
+ *      imprime a tabela das tarefas de agenda.h.
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "executor_tabela.h"
+
+static uint32_t mdc(uint32_t a, uint32_t b) {
+    while (b) {
+        uint32_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+executor_erro_t executor_monta_tabela(const executor_tarefa_t *tarefas, uint32_t n,
+                                      executor_tabela_t *tabela) {
+    memset(tabela, 0, sizeof(*tabela));
+    tabela->quadro_com_erro = -1;
+
+    if (n == 0 || n > EXECUTOR_MAX_TAREFAS) {
+        return EXECUTOR_ERRO_TAREFAS;
+    }
+
+    uint64_t ciclo = 1;
+    uint32_t quadro = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t p = tarefas[i].periodo_ms;
+        if (p == 0 || tarefas[i].offset_ms >= p) {
+            return EXECUTOR_ERRO_PARAMETRO;
+        }
+        ciclo = ciclo / mdc((uint32_t)(ciclo % p), p) * p;   // mmc(ciclo, p)
+        quadro = mdc(quadro, p);
+        quadro = mdc(quadro, tarefas[i].offset_ms);
+        if (ciclo / quadro > EXECUTOR_MAX_QUADROS) {
+            return EXECUTOR_ERRO_QUADROS;
+        }
+    }
+
+    tabela->ciclo_maior_ms = (uint32_t)ciclo;
+    tabela->quadro_ms = quadro;
+    tabela->n_quadros = (uint16_t)(ciclo / quadro);
+
+    for (uint32_t q = 0; q < tabela->n_quadros; q++) {
+        uint32_t instante = q * quadro;
+        for (uint32_t i = 0; i < n; i++) {
+            if (instante % tarefas[i].periodo_ms != tarefas[i].offset_ms) {
+                continue;
+            }
+            if (tabela->n_no_quadro[q] == EXECUTOR_MAX_POR_QUADRO) {
+                tabela->quadro_com_erro = (int)q;
+                return EXECUTOR_ERRO_POR_QUADRO;
+            }
+            tabela->tarefas[q][tabela->n_no_quadro[q]++] = (uint8_t)i;
+            tabela->carga_us[q] += tarefas[i].orcamento_us;
+        }
+        if (tabela->carga_us[q] > quadro * 1000u) {
+            tabela->quadro_com_erro = (int)q;
+            return EXECUTOR_ERRO_SOBRECARGA;
+        }
+    }
+
+    return EXECUTOR_OK;
+}
+
+const char *executor_erro_para_texto(executor_erro_t erro) {
+    switch (erro) {
+        case EXECUTOR_OK:              return "ok";
+        case EXECUTOR_ERRO_TAREFAS:    return "numero de tarefas invalido";
+        case EXECUTOR_ERRO_PARAMETRO:  return "periodo nulo ou offset >= periodo";
+        case EXECUTOR_ERRO_QUADROS:    return "quadros demais no ciclo maior";
+        case EXECUTOR_ERRO_POR_QUADRO: return "tarefas demais em um quadro";
+        case EXECUTOR_ERRO_SOBRECARGA: return "orcamentos passam do quadro";
+        default:                       return "?";
+    }
+}
+
+void executor_imprime_tabela(const executor_tarefa_t *tarefas, const executor_tabela_t *tabela) {
+    uint32_t carga_total = 0;
+    uint32_t carga_max = 0;
+    uint32_t resposta_max[EXECUTOR_MAX_TAREFAS] = { 0 };
+    uint32_t n_tarefas = 0;
+
+    printf("[EXECUTOR] Ciclo maior %lu ms, quadro menor %lu ms, %u quadros\n",
+           (unsigned long)tabela->ciclo_maior_ms, (unsigned long)tabela->quadro_ms,
+           tabela->n_quadros);
+
+    for (uint32_t q = 0; q < tabela->n_quadros; q++) {
+        printf("  %3lu | %5lu ms | %5.1f%% |", (unsigned long)q,
+               (unsigned long)(q * tabela->quadro_ms),
+               100.0f * tabela->carga_us[q] / (tabela->quadro_ms * 1000.0f));
+        uint32_t fim_us = 0;
+        for (uint32_t k = 0; k < tabela->n_no_quadro[q]; k++) {
+            uint8_t i = tabela->tarefas[q][k];
+            printf(" %s", tarefas[i].nome);
+
+            // Resposta pelos orçamentos: as anteriores do quadro gastam todo o orçamento
+            fim_us += tarefas[i].orcamento_us;
+            if (fim_us > resposta_max[i]) {
+                resposta_max[i] = fim_us;
+            }
+            if (i + 1u > n_tarefas) {
+                n_tarefas = i + 1u;
+            }
+        }
+        printf("\n");
+        carga_total += tabela->carga_us[q];
+        if (tabela->carga_us[q] > carga_max) {
+            carga_max = tabela->carga_us[q];
+        }
+    }
+
+    printf("[EXECUTOR] Utilização pelos orçamentos: %.1f%% (quadro mais cheio %.1f%%)\n",
+           100.0f * carga_total / (tabela->ciclo_maior_ms * 1000.0f),
+           100.0f * carga_max / (tabela->quadro_ms * 1000.0f));
+    for (uint32_t i = 0; i < n_tarefas; i++) {
+        printf("  %-10s orçamento %5lu us, pior resposta %5lu us\n", tarefas[i].nome,
+               (unsigned long)tarefas[i].orcamento_us, (unsigned long)resposta_max[i]);
+    }
+}
+
+#ifdef EXECUTOR_TABELA_HOST
+// Ferramenta de PC: monta e imprime a tabela das tarefas de agenda.h
+#include "agenda.h"
+
+#define TAREFA_SEM_FUNCAO(nome, funcao, periodo, offset, orcamento) \
+    { nome, NULL, periodo, offset, orcamento },
+
+int main(void) {
+    static const executor_tarefa_t tarefas[] = { AGENDA_TAREFAS(TAREFA_SEM_FUNCAO) };
+    static executor_tabela_t tabela;
+    uint32_t n = sizeof(tarefas) / sizeof(tarefas[0]);
+
+    executor_erro_t erro = executor_monta_tabela(tarefas, n, &tabela);
+    if (erro != EXECUTOR_OK) {
+        printf("Tabela recusada: %s", executor_erro_para_texto(erro));
+        if (tabela.quadro_com_erro >= 0) {
+            printf(" (quadro %d)", tabela.quadro_com_erro);
+        }
+        printf("\n");
+        return 1;
+    }
+    executor_imprime_tabela(tarefas, &tabela);
+    return 0;
+}
+#endif
@@ -0,0 +1,87 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: executor_tabela.h
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Montagem da tabela de um executor cíclico clássico
+ *      (ciclo maior / quadros menores) a partir das tarefas
+ *      registradas com período, offset e orçamento.
+ *
+ *      - Ciclo maior (hiperperíodo): mmc dos períodos.
+ *      - Quadro menor: mdc dos períodos e dos offsets, de modo
+ *        que toda liberação de tarefa caia no início de um
+ *        quadro e nenhuma precise esperar o quadro seguinte.
+ *      - Em cada quadro, as tarefas liberadas naquele instante,
+ *        na ordem de registro; a soma dos orçamentos tem de
+ *        caber no quadro.
+ *
+ *      Só C padrão: o mesmo código monta a tabela na placa
+ *      (executor_ciclico.c) e no PC, como ferramenta:
+ *          gcc -DEXECUTOR_TABELA_HOST -I. executor_tabela.c -o tabela
+ *          ./tabela
+ *      imprime a tabela das tarefas de agenda.h.
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#ifndef EXECUTOR_TABELA_H
+#define EXECUTOR_TABELA_H
+
+#include <stdint.h>
+
+#define EXECUTOR_MAX_TAREFAS 12
+#define EXECUTOR_MAX_QUADROS 100     // Quadros menores por ciclo maior
+#define EXECUTOR_MAX_POR_QUADRO 8
+
+typedef void (*executor_funcao_t)(void);
+
+typedef struct {
+    const char *nome;
+    executor_funcao_t funcao;
+    uint32_t periodo_ms;
+    uint32_t offset_ms;          // Primeira liberação dentro do período (< período)
+    uint32_t orcamento_us;       // Tempo máximo de execução esperado (WCET)
+} executor_tarefa_t;
+
+typedef struct {
+    uint32_t ciclo_maior_ms;
+    uint32_t quadro_ms;
+    uint16_t n_quadros;
+    uint8_t n_no_quadro[EXECUTOR_MAX_QUADROS];
+    uint8_t tarefas[EXECUTOR_MAX_QUADROS][EXECUTOR_MAX_POR_QUADRO];   // Índices das tarefas
+    uint32_t carga_us[EXECUTOR_MAX_QUADROS];                          // Soma dos orçamentos
+    int quadro_com_erro;         // Quadro que não coube (-1 se nenhum)
+} executor_tabela_t;
+
+typedef enum {
+    EXECUTOR_OK = 0,
+    EXECUTOR_ERRO_TAREFAS,       // Nenhuma tarefa ou mais de EXECUTOR_MAX_TAREFAS
+    EXECUTOR_ERRO_PARAMETRO,     // Período nulo ou offset >= período
+    EXECUTOR_ERRO_QUADROS,       // Ciclo maior com mais de EXECUTOR_MAX_QUADROS quadros
+    EXECUTOR_ERRO_POR_QUADRO,    // Mais de EXECUTOR_MAX_POR_QUADRO tarefas em um quadro
+    EXECUTOR_ERRO_SOBRECARGA     // Orçamentos de um quadro passam da duração do quadro
+} executor_erro_t;
+
+/**
+ * @brief Monta a tabela de quadros para as `n` tarefas.
+ *
+ * @return EXECUTOR_OK ou o motivo da recusa (em sobrecarga, tabela->quadro_com_erro
+ *         indica o quadro).
+ */
+executor_erro_t executor_monta_tabela(const executor_tarefa_t *tarefas, uint32_t n,
+                                      executor_tabela_t *tabela);
+
+const char *executor_erro_para_texto(executor_erro_t erro);
+
+/**
+ * @brief Imprime ciclo maior, quadro menor e, por quadro, as tarefas e a carga.
+ *
+ * Depois, a utilização pelos orçamentos e, por tarefa, a pior resposta pelos orçamentos
+ * (da abertura do quadro ao fim da tarefa, com as anteriores do quadro gastando todo o
+ * orçamento), comparável à resposta medida por executor_ciclico.c.
+ */
+void executor_imprime_tabela(const executor_tarefa_t *tarefas, const executor_tabela_t *tabela);
+
+#endif  // EXECUTOR_TABELA_H
@@ -3,6 +3,9 @@
 
 #include <stdint.h>
 
+const uint8_t* get_big_bitmap(char c);
+int get_char_width(char c);
+int calc_string_width(const char *str);
 void draw_big_string_aligned_right(uint8_t *ssd, int y, const char *str);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include <string.h>
+#include "ssd1306.h"
+#include "draw_big_char.h"
+
+#define BIG_CHAR_WIDTH 16
+#define BIG_CHAR_PAGES 4
+
+// Grava `n` bytes em uma página do buffer e marca como suja só a faixa de colunas que mudou.
+// `keep` são os bits do destino preservados (0x00 = cópia da página inteira).
+static void put_page(uint8_t *ssd, int page, int x, const uint8_t *src, int n, uint8_t keep, int shift) {
+    uint8_t *dst = &ssd[page * ssd1306_width + x];
+    int first = -1, last = -1;
+
+    for (int c = 0; c < n; c++) {
+        uint8_t bits = shift >= 0 ? (uint8_t)(src[c] << shift) : (uint8_t)(src[c] >> -shift);
+        uint8_t v = (dst[c] & keep) | bits;
+        if (dst[c] != v) {
+            dst[c] = v;
+            if (first < 0) first = c;
+            last = c;
+        }
+    }
+
+    if (first >= 0) {
+        ssd1306_mark_dirty(x + first, page * 8, x + last, page * 8 + 7);
+    }
+}
+
+// Copia o glifo página a página: com y múltiplo de 8 cada página é uma cópia direta de
+// 16 bytes; caso contrário cada coluna é deslocada e mesclada nas duas páginas cobertas.
+void draw_big_char(uint8_t *ssd, int x, int y, const uint8_t *bitmap) {
+    int col0 = x < 0 ? -x : 0;
+    int col1 = x + BIG_CHAR_WIDTH > ssd1306_width ? ssd1306_width - x : BIG_CHAR_WIDTH;
+    if (col0 >= col1 || y <= -32 || y >= ssd1306_height) {
+        return;
+    }
+
+    int n = col1 - col0;
+    int shift = y & 7;
+    int page_base = (y - shift) / 8;   // arredonda para baixo também com y negativo
+
+    for (int p = 0; p < BIG_CHAR_PAGES; p++) {
+        const uint8_t *src = &bitmap[p * BIG_CHAR_WIDTH + col0];
+        int dp = page_base + p;
+
+        if (shift == 0) {
+            if (dp >= 0 && dp < ssd1306_n_pages) {
+                put_page(ssd, dp, x + col0, src, n, 0x00, 0);
+            }
+            continue;
+        }
+
+        uint8_t mask_lo = (uint8_t)(0xFF << shift);
+        if (dp >= 0 && dp < ssd1306_n_pages) {
+            put_page(ssd, dp, x + col0, src, n, (uint8_t)~mask_lo, shift);
+        }
+        if (dp + 1 >= 0 && dp + 1 < ssd1306_n_pages) {
+            put_page(ssd, dp + 1, x + col0, src, n, mask_lo, shift - 8);
+        }
+    }
+}
@@ -2,6 +2,10 @@
 #define FONT_BIG_LOGO_H
 #include <stdint.h>
 
+// Cada glifo tem 16x32 pixels no formato de página do SSD1306: 4 páginas de 16 bytes,
+// cada byte uma coluna de 8 pixels com o bit 0 no topo. Assim draw_big_char() copia
+// bytes inteiros para o buffer do display em vez de acender pixel por pixel.
+
 // Caracteres especiais
 extern const uint8_t big_char_plus[64];
 extern const uint8_t big_char_minus[64];
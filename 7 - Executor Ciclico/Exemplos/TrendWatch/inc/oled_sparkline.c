@@ -0,0 +1,139 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: oled_sparkline.c
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação do gráfico de histórico em varredura.
+ *      Cada coluna liga a amostra anterior à atual com um
+ *      segmento vertical; a coluna seguinte fica apagada.
+ *
+ *  Data: 16/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "ssd1306.h"
+#include "oled_sparkline.h"
+
+void sparkline_inicia(sparkline_t *s, uint8_t x, uint8_t pagina, uint8_t largura, uint8_t paginas) {
+    memset(s, 0, sizeof(*s));
+    s->x = x;
+    s->pagina = pagina;
+    s->largura = MIN(MIN(largura, ssd1306_width - x), SPARKLINE_MAX_AMOSTRAS);
+    s->paginas = MIN(MIN(paginas, ssd1306_n_pages - pagina), 4);   // Coluna cabe em 32 bits
+}
+
+// Linha (0 = topo do gráfico) correspondente a um valor na escala atual
+static int linha_do_valor(const sparkline_t *s, int16_t v) {
+    int altura = s->paginas * 8;
+    return (altura - 1) - (int32_t)(v - s->y_min) * (altura - 1) / (s->y_max - s->y_min);
+}
+
+// Grava em ssd[] os bits de uma coluna do gráfico, marcando só as páginas alteradas
+static void grava_coluna(const sparkline_t *s, uint8_t *ssd, int coluna, uint32_t bits) {
+    int x = s->x + coluna;
+
+    for (int p = 0; p < s->paginas; p++) {
+        uint8_t *destino = &ssd[(s->pagina + p) * ssd1306_width + x];
+        uint8_t novo = (uint8_t)(bits >> (p * 8));
+        if (*destino != novo) {
+            *destino = novo;
+            uint8_t y = (s->pagina + p) * 8;
+            ssd1306_mark_dirty(x, y, x, y + 7);
+        }
+    }
+}
+
+// Desenha a amostra da posição `k` ligada à anterior (se houver)
+static void desenha_amostra(const sparkline_t *s, uint8_t *ssd, int k, bool tem_anterior) {
+    int atual = linha_do_valor(s, s->amostras[k]);
+    int anterior = atual;
+
+    if (tem_anterior) {
+        anterior = linha_do_valor(s, s->amostras[(k + s->largura - 1) % s->largura]);
+    }
+
+    int y0 = MIN(atual, anterior);
+    int y1 = MAX(atual, anterior);
+    uint32_t bits = (y1 >= 31 ? 0xFFFFFFFFu : ((1u << (y1 + 1)) - 1)) & ~((1u << y0) - 1);
+    grava_coluna(s, ssd, k, bits);
+}
+
+// Percorre o anel para achar os extremos: só quando a amostra que saiu era um deles
+static void recalcula_extremos(sparkline_t *s) {
+    s->menor = INT16_MAX;
+    s->maior = INT16_MIN;
+    for (int i = 0; i < s->total; i++) {
+        int k = (s->cabeca + s->largura - 1 - i) % s->largura;
+        s->menor = MIN(s->menor, s->amostras[k]);
+        s->maior = MAX(s->maior, s->amostras[k]);
+    }
+}
+
+// Ajusta a escala aos extremos das amostras, em degraus de SPARKLINE_PASSO.
+// Retorna true se a faixa mudou.
+static bool ajusta_escala(sparkline_t *s) {
+    int16_t menor = s->menor, maior = s->maior;
+
+    // Arredonda para fora (também com valores negativos)
+    int16_t y_min = (menor >= 0) ? (menor / SPARKLINE_PASSO) * SPARKLINE_PASSO
+                                 : -((-menor + SPARKLINE_PASSO - 1) / SPARKLINE_PASSO) * SPARKLINE_PASSO;
+    int16_t y_max = y_min + SPARKLINE_PASSO;
+    while (y_max < maior) {
+        y_max += SPARKLINE_PASSO;
+    }
+
+    if (y_min == s->y_min && y_max == s->y_max) {
+        return false;
+    }
+    s->y_min = y_min;
+    s->y_max = y_max;
+    return true;
+}
+
+void sparkline_adiciona(sparkline_t *s, uint8_t *ssd, float valor) {
+    int k = s->cabeca;
+    bool primeira = s->total == 0;
+
+    int16_t v = (int16_t)(valor * 100.0f + (valor >= 0 ? 0.5f : -0.5f));
+    bool cheio = s->total == s->largura;
+    int16_t saindo = s->amostras[k];
+
+    s->amostras[k] = v;
+    s->cabeca = (k + 1) % s->largura;
+    if (!cheio) {
+        s->total++;
+    }
+
+    // Extremos em O(1); o anel só é percorrido se a amostra sobrescrita era um deles
+    if (primeira) {
+        s->menor = s->maior = v;
+    } else if (cheio && (saindo == s->menor || saindo == s->maior)) {
+        recalcula_extremos(s);
+    } else {
+        s->menor = MIN(s->menor, v);
+        s->maior = MAX(s->maior, v);
+    }
+
+    if (ajusta_escala(s) && !primeira) {
+        // Escala mudou: redesenha todas as amostras válidas na nova faixa
+        s->redesenhos++;
+        int mais_antiga = (s->cabeca + s->largura - s->total) % s->largura;
+        for (int i = 0; i < s->largura; i++) {
+            int pos = (mais_antiga + i) % s->largura;
+            if (i < s->total) {
+                desenha_amostra(s, ssd, pos, i > 0);
+            } else {
+                grava_coluna(s, ssd, pos, 0);
+            }
+        }
+    } else {
+        desenha_amostra(s, ssd, k, !primeira);
+    }
+
+    // Cursor: a coluna seguinte (amostra mais antiga) fica apagada
+    if (s->largura > 1) {
+        grava_coluna(s, ssd, s->cabeca, 0);
+    }
+}
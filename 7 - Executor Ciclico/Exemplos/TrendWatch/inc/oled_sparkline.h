@@ -0,0 +1,54 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: oled_sparkline.h
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Gráfico de histórico (sparkline) para o OLED SSD1306.
+ *
+ *      As amostras ficam em um anel de tamanho fixo em que a
+ *      posição k do anel é a coluna k do gráfico (varredura,
+ *      como em um monitor cardíaco): cada nova amostra desenha
+ *      uma única coluna e apaga a seguinte, que serve de
+ *      cursor. O custo por ponto é constante: 2 colunas em
+ *      ssd[] e, no envio, 2 bytes por página do gráfico.
+ *
+ *      A escala vertical é automática, em degraus de
+ *      SPARKLINE_PASSO. Os extremos das amostras são mantidos
+ *      a cada ponto; o anel só é percorrido de novo quando a
+ *      amostra que sai era o menor ou o maior valor. O gráfico
+ *      inteiro só é redesenhado quando os limites mudam de
+ *      degrau.
+ *
+ *      A rolagem horizontal do SSD1306 (26h/27h, usada por
+ *      ssd1306_scroll) anda continuamente no ritmo do quadro
+ *      do controlador e não avança uma coluna por amostra,
+ *      por isso a varredura é feita em ssd[].
+ *
+ *  Data: 16/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef OLED_SPARKLINE_H
+#define OLED_SPARKLINE_H
+
+#include <stdint.h>
+
+#define SPARKLINE_MAX_AMOSTRAS 128   // Uma amostra por coluna
+#define SPARKLINE_PASSO 50           // Degrau da escala: 0,5 °C (em centésimos)
+
+typedef struct {
+    uint8_t x, pagina;              // Canto superior esquerdo (coluna, página)
+    uint8_t largura, paginas;       // Região fixa do gráfico
+    int16_t amostras[SPARKLINE_MAX_AMOSTRAS];   // Centésimos de °C
+    uint16_t total;                 // Amostras válidas no anel (até `largura`)
+    uint16_t cabeca;                // Posição (e coluna) da próxima amostra
+    int16_t menor, maior;           // Extremos das amostras válidas (centésimos)
+    int16_t y_min, y_max;           // Faixa vertical atual (centésimos)
+    uint32_t redesenhos;            // Redesenhos completos por mudança de escala
+} sparkline_t;
+
+void sparkline_inicia(sparkline_t *s, uint8_t x, uint8_t pagina, uint8_t largura, uint8_t paginas);
+void sparkline_adiciona(sparkline_t *s, uint8_t *ssd, float valor);
+
+#endif
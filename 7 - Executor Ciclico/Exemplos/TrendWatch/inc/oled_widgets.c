@@ -0,0 +1,159 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: oled_widgets.c
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementação dos widgets em modo retido. Cada widget
+ *      compõe sua região em um rascunho (mesmo formato de
+ *      página do SSD1306) e depois o compara com ssd[]: só as
+ *      colunas diferentes são copiadas e marcadas como sujas.
+ *
+ *  Data: 16/10/2026
+ * ------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "ssd1306.h"
+#include "big_string_drawer.h"
+#include "oled_widgets.h"
+
+// Rascunho da região do widget: `paginas` linhas de `largura` bytes
+static uint8_t rascunho[ssd1306_buffer_length];
+
+static void widget_inicia(oled_widget_t *w, widget_tipo_t tipo, uint8_t x, uint8_t pagina,
+                          uint8_t largura, uint8_t paginas, widget_alinhamento_t alinhamento) {
+    memset(w, 0, sizeof(*w));
+    w->tipo = tipo;
+    w->alinhamento = alinhamento;
+    w->x = x;
+    w->pagina = pagina;
+    w->largura = MIN(largura, ssd1306_width - x);
+    w->paginas = MIN(paginas, ssd1306_n_pages - pagina);
+}
+
+void widget_rotulo(oled_widget_t *w, uint8_t x, uint8_t pagina, uint8_t largura, widget_alinhamento_t alinhamento) {
+    widget_inicia(w, WIDGET_ROTULO, x, pagina, largura, 1, alinhamento);
+}
+
+void widget_numero_grande(oled_widget_t *w, uint8_t x, uint8_t pagina, uint8_t largura, uint8_t paginas, widget_alinhamento_t alinhamento) {
+    widget_inicia(w, WIDGET_NUMERO_GRANDE, x, pagina, largura, MIN(paginas, 4), alinhamento);
+}
+
+void widget_icone(oled_widget_t *w, uint8_t x, uint8_t pagina, uint8_t largura, uint8_t paginas) {
+    widget_inicia(w, WIDGET_ICONE, x, pagina, largura, paginas, WIDGET_ESQUERDA);
+}
+
+void widget_barra(oled_widget_t *w, uint8_t x, uint8_t pagina, uint8_t largura) {
+    widget_inicia(w, WIDGET_BARRA, x, pagina, largura, 1, WIDGET_ESQUERDA);
+}
+
+// Copia para o rascunho `colunas` bytes por página a partir da coluna `col` (com recorte)
+static void rascunho_copia(const oled_widget_t *w, int col, const uint8_t *origem, int colunas, int paginas) {
+    for (int p = 0; p < paginas && p < w->paginas; p++) {
+        for (int c = 0; c < colunas; c++) {
+            if (col + c >= 0 && col + c < w->largura) {
+                rascunho[p * w->largura + col + c] = origem[p * colunas + c];
+            }
+        }
+    }
+}
+
+// Compara o rascunho com ssd[] e grava apenas as colunas que mudaram
+static void widget_aplica(const oled_widget_t *w, uint8_t *ssd) {
+    for (int p = 0; p < w->paginas; p++) {
+        const uint8_t *novo = &rascunho[p * w->largura];
+        uint8_t *destino = &ssd[(w->pagina + p) * ssd1306_width + w->x];
+        int primeira = -1, ultima = -1;
+
+        for (int c = 0; c < w->largura; c++) {
+            if (destino[c] != novo[c]) {
+                destino[c] = novo[c];
+                if (primeira < 0) primeira = c;
+                ultima = c;
+            }
+        }
+
+        if (primeira >= 0) {
+            uint8_t y = (w->pagina + p) * 8;
+            ssd1306_mark_dirty(w->x + primeira, y, w->x + ultima, y + 7);
+        }
+    }
+}
+
+static int widget_desloca(const oled_widget_t *w, int largura_conteudo) {
+    switch (w->alinhamento) {
+        case WIDGET_CENTRO:  return (w->largura - largura_conteudo) / 2;
+        case WIDGET_DIREITA: return w->largura - largura_conteudo;
+        default:             return 0;
+    }
+}
+
+bool widget_texto(oled_widget_t *w, uint8_t *ssd, const char *texto) {
+    if (w->desenhado && strncmp(w->valor.texto, texto, WIDGET_TEXTO_MAX) == 0) {
+        return false;
+    }
+    strncpy(w->valor.texto, texto, WIDGET_TEXTO_MAX);
+    w->valor.texto[WIDGET_TEXTO_MAX] = '\0';
+    w->desenhado = true;
+
+    memset(rascunho, 0, w->paginas * w->largura);
+
+    if (w->tipo == WIDGET_NUMERO_GRANDE) {
+        // Fonte grande: glifos de 16 colunas; '.' e 'o' avançam só 8 e o próximo sobrepõe
+        int col = widget_desloca(w, calc_string_width(w->valor.texto));
+        for (const char *c = w->valor.texto; *c; c++) {
+            const uint8_t *bitmap = get_big_bitmap(*c);
+            if (bitmap) {
+                rascunho_copia(w, col, bitmap, 16, 4);
+            }
+            col += get_char_width(*c);
+        }
+    } else {
+        int col = widget_desloca(w, strlen(w->valor.texto) * 8);
+        for (const char *c = w->valor.texto; *c; c++) {
+            rascunho_copia(w, col, ssd1306_glyph(*c), 8, 1);
+            col += 8;
+        }
+    }
+
+    widget_aplica(w, ssd);
+    return true;
+}
+
+bool widget_icone_set(oled_widget_t *w, uint8_t *ssd, const uint8_t *bitmap) {
+    if (w->desenhado && w->valor.icone == bitmap) {
+        return false;
+    }
+    w->valor.icone = bitmap;
+    w->desenhado = true;
+
+    memset(rascunho, 0, w->paginas * w->largura);
+    if (bitmap) {
+        rascunho_copia(w, 0, bitmap, w->largura, w->paginas);
+    }
+
+    widget_aplica(w, ssd);
+    return true;
+}
+
+bool widget_barra_set(oled_widget_t *w, uint8_t *ssd, uint8_t percentual) {
+    if (percentual > 100) percentual = 100;
+    if (w->desenhado && w->valor.percentual == percentual) {
+        return false;
+    }
+    w->valor.percentual = percentual;
+    w->desenhado = true;
+
+    // Moldura de 6 px de altura com o preenchimento proporcional por dentro
+    int interno = w->largura - 2;
+    int cheio = interno * percentual / 100;
+    rascunho[0] = 0x7E;
+    for (int c = 0; c < interno; c++) {
+        rascunho[1 + c] = c < cheio ? 0x7E : 0x42;
+    }
+    rascunho[w->largura - 1] = 0x7E;
+
+    widget_aplica(w, ssd);
+    return true;
+}
@@ -0,0 +1,86 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: oled_widgets.h
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Camada de interface em modo retido para o OLED SSD1306.
+ *      Cada widget ocupa uma região fixa da tela (coluna x,
+ *      página inicial, largura e número de páginas) e guarda
+ *      o último valor desenhado.
+ *
+ *      Ao receber um valor:
+ *        - igual ao anterior: nada é desenhado nem enviado;
+ *        - diferente: a região é recomposta e somente os bytes
+ *          que mudaram são gravados em ssd[] e marcados como
+ *          sujos, de modo que o próximo render_on_display()
+ *          envia apenas essas colunas.
+ *
+ *      Tipos disponíveis:
+ *        - Rótulo (fonte 8x8, 1 página)
+ *        - Número grande (fonte 16x32 de font_big_logo.h)
+ *        - Ícone (bitmap no formato de página)
+ *        - Barra horizontal (0 a 100 %, 1 página)
+ *
+ *  Data: 16/10/2026
+ * ------------------------------------------------------------
+ */
+
+#ifndef OLED_WIDGETS_H
+#define OLED_WIDGETS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define WIDGET_TEXTO_MAX 16   // 128 px / 8 px por caractere
+
+typedef enum {
+    WIDGET_ROTULO,
+    WIDGET_NUMERO_GRANDE,
+    WIDGET_ICONE,
+    WIDGET_BARRA
+} widget_tipo_t;
+
+typedef enum {
+    WIDGET_ESQUERDA,
+    WIDGET_CENTRO,
+    WIDGET_DIREITA
+} widget_alinhamento_t;
+
+typedef struct {
+    widget_tipo_t tipo;
+    widget_alinhamento_t alinhamento;
+    uint8_t x, pagina;          // Canto superior esquerdo (coluna, página)
+    uint8_t largura, paginas;   // Região fixa, em colunas e páginas
+    bool desenhado;             // false até o primeiro valor
+    union {
+        char texto[WIDGET_TEXTO_MAX + 1];   // Rótulo e número grande
+        const uint8_t *icone;
+        uint8_t percentual;                 // Barra
+    } valor;
+} oled_widget_t;
+
+void widget_rotulo(oled_widget_t *w, uint8_t x, uint8_t pagina, uint8_t largura, widget_alinhamento_t alinhamento);
+void widget_numero_grande(oled_widget_t *w, uint8_t x, uint8_t pagina, uint8_t largura, uint8_t paginas, widget_alinhamento_t alinhamento);
+void widget_icone(oled_widget_t *w, uint8_t x, uint8_t pagina, uint8_t largura, uint8_t paginas);
+void widget_barra(oled_widget_t *w, uint8_t x, uint8_t pagina, uint8_t largura);
+
+/**
+ * @brief Atualiza o texto de um rótulo ou número grande.
+ * @return true se a região foi redesenhada (valor diferente do anterior)
+ */
+bool widget_texto(oled_widget_t *w, uint8_t *ssd, const char *texto);
+
+/**
+ * @brief Atualiza o bitmap de um ícone (largura x paginas bytes, formato de página).
+ * @return true se a região foi redesenhada
+ */
+bool widget_icone_set(oled_widget_t *w, uint8_t *ssd, const uint8_t *bitmap);
+
+/**
+ * @brief Atualiza o preenchimento de uma barra (0 a 100 %).
+ * @return true se a região foi redesenhada
+ */
+bool widget_barra_set(oled_widget_t *w, uint8_t *ssd, uint8_t percentual);
+
+#endif
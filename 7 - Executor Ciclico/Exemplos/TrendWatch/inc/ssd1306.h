@@ -16,4 +16,7 @@ extern void ssd1306_config(ssd1306_t *ssd);
 extern void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
 extern void ssd1306_send_data(ssd1306_t *ssd);
 extern void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap);
-extern void ssd1306_clear_display(uint8_t *ssd);
\ No newline at end of file
+extern void ssd1306_clear_display(uint8_t *ssd);
+extern void ssd1306_mark_dirty(uint8_t x_start, uint8_t y_start, uint8_t x_end, uint8_t y_end);
+extern void ssd1306_mark_all_dirty(void);
+extern const uint8_t *ssd1306_glyph(uint8_t character);
\ No newline at end of file
@@ -8,6 +8,62 @@
 #include "ssd1306_font.h"
 #include "ssd1306_i2c.h"
 
+// ------------------------------------------------------------
+// Rastreamento de regiões modificadas (dirty tracking)
+// ------------------------------------------------------------
+// Para cada página (8 linhas de pixels) guarda-se a faixa de colunas alterada
+// desde o último render_on_display(). Uma página limpa não é reenviada.
+static uint32_t dirty_pages = 0;                    // bit N = página N modificada
+static uint8_t dirty_start_col[ssd1306_n_pages];    // primeira coluna modificada
+static uint8_t dirty_end_col[ssd1306_n_pages];      // última coluna modificada
+
+// Amplia a faixa suja de uma página para incluir [col_start, col_end]
+static inline void mark_dirty_span(uint8_t page, uint8_t col_start, uint8_t col_end) {
+    if (dirty_pages & (1u << page)) {
+        if (col_start < dirty_start_col[page]) dirty_start_col[page] = col_start;
+        if (col_end > dirty_end_col[page]) dirty_end_col[page] = col_end;
+    } else {
+        dirty_pages |= 1u << page;
+        dirty_start_col[page] = col_start;
+        dirty_end_col[page] = col_end;
+    }
+}
+
+// Marca como modificado o retângulo (em pixels) informado
+void ssd1306_mark_dirty(uint8_t x_start, uint8_t y_start, uint8_t x_end, uint8_t y_end) {
+    if (x_end >= ssd1306_width) x_end = ssd1306_width - 1;
+    if (y_end >= ssd1306_height) y_end = ssd1306_height - 1;
+    if (x_start > x_end || y_start > y_end) return;
+
+    for (uint8_t page = y_start / 8; page <= y_end / 8; page++) {
+        mark_dirty_span(page, x_start, x_end);
+    }
+}
+
+// Marca a tela inteira como modificada (ex: após memset no buffer)
+void ssd1306_mark_all_dirty(void) {
+    ssd1306_mark_dirty(0, 0, ssd1306_width - 1, ssd1306_height - 1);
+}
+
+// Calcula a janela suja de uma página dentro da área e, se toda a faixa suja couber
+// na área, marca a página como limpa. Retorna false se não houver nada a enviar.
+static bool take_dirty_window(const struct render_area *area, uint8_t page, uint8_t *col_start, uint8_t *col_end) {
+    if (!(dirty_pages & (1u << page))) {
+        return false;
+    }
+
+    *col_start = MAX(dirty_start_col[page], area->start_column);
+    *col_end = MIN(dirty_end_col[page], area->end_column);
+    if (*col_start > *col_end) {
+        return false; // Alteração fora das colunas desta área
+    }
+
+    if (dirty_start_col[page] >= area->start_column && dirty_end_col[page] <= area->end_column) {
+        dirty_pages &= ~(1u << page);
+    }
+    return true;
+}
+
 // Calcular quanto do buffer será destinado à área de renderização
 void calculate_render_area_buffer_length(struct render_area *area) {
     area->buffer_length = (area->end_column - area->start_column + 1) * (area->end_page - area->start_page + 1);
@@ -62,6 +118,9 @@ void ssd1306_init() {
     };
 
     ssd1306_send_command_list(commands, count_of(commands));
+
+    // Conteúdo da RAM do controlador é indefinido após o reset: o primeiro envio é completo
+    ssd1306_mark_all_dirty();
 }
 
 // Cria a lista de comandos para configurar o scrolling
@@ -74,15 +133,27 @@ void ssd1306_scroll(bool set) {
     ssd1306_send_command_list(commands, count_of(commands));
 }
 
-// Atualiza uma parte do display com uma área de renderização
+// Atualiza uma parte do display com uma área de renderização.
+// Somente as páginas modificadas dentro da área são enviadas, cada uma como uma
+// janela (coluna inicial/final, página) contendo apenas a faixa de colunas alterada.
 void render_on_display(uint8_t *ssd, struct render_area *area) {
-    uint8_t commands[] = {
-        ssd1306_set_column_address, area->start_column, area->end_column,
-        ssd1306_set_page_address, area->start_page, area->end_page
-    };
+    int area_width = area->end_column - area->start_column + 1;
 
-    ssd1306_send_command_list(commands, count_of(commands));
-    ssd1306_send_buffer(ssd, area->buffer_length);
+    for (uint8_t page = area->start_page; page <= area->end_page; page++) {
+        uint8_t col_start, col_end;
+        if (!take_dirty_window(area, page, &col_start, &col_end)) {
+            continue;
+        }
+
+        uint8_t commands[] = {
+            ssd1306_set_column_address, col_start, col_end,
+            ssd1306_set_page_address, page, page
+        };
+
+        ssd1306_send_command_list(commands, count_of(commands));
+        ssd1306_send_buffer(ssd + (page - area->start_page) * area_width + (col_start - area->start_column),
+                            col_end - col_start + 1);
+    }
 }
 
 // Determina o pixel a ser aceso (no display) de acordo com a coordenada fornecida
@@ -101,7 +172,10 @@ void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set) {
         byte &= ~(1 << (y % 8));
     }
 
-    ssd[byte_idx] = byte;
+    if (ssd[byte_idx] != byte) {
+        ssd[byte_idx] = byte;
+        mark_dirty_span(y / 8, x, x);
+    }
 }
 
 // Algoritmo de Bresenham básico
@@ -133,7 +207,7 @@ void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool se
 }
 
 // Adquire os pixels para um caractere (de acordo com ssd1306_font.h)
-inline int ssd1306_get_font(uint8_t character)
+static inline int ssd1306_get_font(uint8_t character)
 {
   if (character >= 'A' && character <= 'Z') {
     return character - 'A' + 1;
@@ -145,6 +219,11 @@ inline int ssd1306_get_font(uint8_t character)
     return 0;
 }
 
+// Retorna as 8 colunas (bit 0 no topo) do caractere na fonte padrão
+const uint8_t *ssd1306_glyph(uint8_t character) {
+    return &font[ssd1306_get_font(toupper(character)) * 8];
+}
+
 // Desenha um único caractere no display
 void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character) {
     if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
@@ -153,12 +232,21 @@ void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character) {
 
     y = y / 8;
 
-    character = toupper(character);
-    int idx = ssd1306_get_font(character);
+    const uint8_t *glyph = ssd1306_glyph(character);
     int fb_idx = y * 128 + x;
+    int first_changed = -1, last_changed = -1;
 
     for (int i = 0; i < 8; i++) {
-        ssd[fb_idx++] = font[idx * 8 + i];
+        if (ssd[fb_idx + i] != glyph[i]) {
+            ssd[fb_idx + i] = glyph[i];
+            if (first_changed < 0) first_changed = i;
+            last_changed = i;
+        }
+    }
+
+    // Redesenhar o mesmo caractere não gera tráfego no próximo envio
+    if (first_changed >= 0) {
+        mark_dirty_span(y, x + first_changed, x + last_changed);
     }
 }
 
@@ -246,6 +334,7 @@ void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap) {
 
 void ssd1306_clear_display(uint8_t *ssd) {
     memset(ssd, 0, ssd1306_buffer_length);
+    ssd1306_mark_all_dirty();
     struct render_area area = {
         .start_column = 0,
         .end_column = ssd1306_width - 1,
@@ -4,20 +4,23 @@
  *  Projeto: TempCycleDMA
  * ------------------------------------------------------------
  *  Descrição:
- *      Este arquivo implementa o handler de interrupção do
- *      canal DMA 0, utilizado para leitura do sensor interno
- *      de temperatura via ADC do Raspberry Pi Pico W.
+ *      Este arquivo implementa o handler de interrupção dos
+ *      canais DMA do ping-pong de temperatura (DMA_TEMP_CHANNEL
+ *      e DMA_TEMP_CHANNEL_B), que leem o sensor interno via ADC
+ *      do Raspberry Pi Pico W.
  *
  *      A função 'dma_handler_temp()' é responsável por
  *      capturar a interrupção do DMA, limpar o status e
- *      sinalizar a finalização da transferência de dados
- *      via flag global 'dma_temp_done'.
+ *      contar as metades do buffer concluídas no contador
+ *      global 'dma_temp_metades'. Os canais se rearmam sozinhos
+ *      (encadeamento + ring de escrita), então o handler não
+ *      reprograma nada.
  *
  *  Relacionamento:
  *      - Este handler é registrado em 'setup.c' usando:
  *            irq_set_exclusive_handler(DMA_IRQ_0, dma_handler_temp);
- *      - A flag 'dma_temp_done' é usada em 'tarefa1_temp.c'
- *        para controlar o fluxo da aquisição via DMA.
+ *      - O contador 'dma_temp_metades' é usado em 'tarefa1_temp.c'
+ *        para saber qual metade do buffer está pronta.
  *
  *  
  *  Data: 11/05/2025
@@ -26,20 +29,21 @@
 
 #include "hardware/dma.h"
 #include "irq_handlers.h"
+#include "setup.h"
 
-// Flag global que sinaliza a conclusão da transferência DMA
-volatile bool dma_temp_done = false;
+// Metades do buffer de temperatura concluídas desde o início da aquisição
+volatile uint32_t dma_temp_metades = 0;
 
 /**
- * @brief Handler de interrupção do canal DMA 0.
+ * @brief Handler de interrupção dos canais DMA de temperatura.
  *
- * Esta função é chamada automaticamente quando o canal 0 do DMA
- * completa a transferência das amostras do ADC para o buffer.
- * Ela limpa a flag da interrupção e ativa o sinalizador
- * 'dma_temp_done' para que o laço principal saiba que pode
- * prosseguir.
+ * Esta função é chamada automaticamente quando um dos canais
+ * termina a sua metade do buffer (o outro já foi disparado pelo
+ * encadeamento). Ela limpa as flags da interrupção e incrementa
+ * 'dma_temp_metades' para que a Tarefa 1 saiba qual metade ler.
  */
 void dma_handler_temp() {
-    dma_hw->ints0 = 1u << 0;   // Limpa a interrupção do canal 0
-    dma_temp_done = true;     // Sinaliza conclusão para o executor
+    uint32_t status = dma_hw->ints0 & ((1u << DMA_TEMP_CHANNEL) | (1u << DMA_TEMP_CHANNEL_B));
+    dma_hw->ints0 = status;                           // Limpa a interrupção dos canais
+    dma_temp_metades += __builtin_popcount(status);   // Sinaliza metade pronta ao executor
 }
\ No newline at end of file
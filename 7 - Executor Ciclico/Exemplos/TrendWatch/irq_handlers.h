@@ -1,9 +1,9 @@
 #ifndef IRQ_HANDLERS_H
 #define IRQ_HANDLERS_H
 
-#include <stdbool.h>
+#include <stdint.h>
 
-extern volatile bool dma_temp_done;
+extern volatile uint32_t dma_temp_metades;
 void dma_handler_temp(void);
 
 #endif
\ No newline at end of file
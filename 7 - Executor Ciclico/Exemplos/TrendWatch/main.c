@@ -5,11 +5,20 @@
  * ------------------------------------------------------------
  *  Descrição:
  *      Ciclo principal do sistema embarcado, baseado em um
- *      executor cíclico com 3 tarefas principais:
+ *      executor cíclico dirigido por tabela (executor_ciclico.c).
+ *      As tarefas são registradas em agenda.h com período,
+ *      offset e orçamento; um alarme de hardware abre cada
+ *      quadro menor de 20 ms:
  *
- *      Tarefa 1 - Leitura da temperatura via DMA (meio segundo)
- *      Tarefa 2 - Exibição da temperatura e tendência no OLED
- *      Tarefa 3 - Análise da tendência da temperatura
+ *      Animação - Quadros da matriz NeoPixel (50 Hz)
+ *      Tarefa 1 - Média da temperatura (ADC + DMA contínuos),
+ *                 em fases: início, acumulação e conclusão
+ *      Tarefa 2 - Análise da tendência da temperatura
+ *      Tarefa 3 - Exibição da temperatura e tendência no OLED
+ *      Tarefa 4 - Cor da matriz NeoPixel por tendência
+ *      Tarefa 5 - Média em blocos + LED RGB
+ *      Relatório - Temperatura no terminal (1 Hz) e tempos (10 s)
+ *      Trace     - Descarga do rastro de execução pela USB (5 Hz)
  *
  *      O sistema utiliza watchdog para segurança, terminal USB
  *      para monitoramento e display OLED para visualização direta.
@@ -32,96 +41,137 @@
 #include "testes_cores.h"  
 #include "pico/stdio_usb.h"
 #include "tarefa5_movel_gpio_deadline.h"
+#include "executor_ciclico.h"
+#include "agenda.h"
+#include "trace.h"
 
 void tarefa_1();
+void tarefa_1_fases();
 void tarefa_2();
 void tarefa_3();
 void tarefa_4();
-void tarefa_5(absolute_time_t inicio_ciclo);
+void tarefa_5();
+void tarefa_anima();
+void tarefa_relatorio();
+void tarefa_trace();
+
+#define TAREFA_DA_AGENDA(nome, funcao, periodo, offset, orcamento) \
+    { nome, funcao, periodo, offset, orcamento },
+
+static const executor_tarefa_t tarefas[] = { AGENDA_TAREFAS(TAREFA_DA_AGENDA) };
+#define NUM_TAREFAS (sizeof(tarefas) / sizeof(tarefas[0]))
 
 
 float media;
 tendencia_t t;
-absolute_time_t ini_tarefa1, fim_tarefa1, ini_tarefa2, fim_tarefa2, ini_tarefa3, fim_tarefa3, ini_tarefa4, fim_tarefa4, ini_tarefa5, fim_tarefa5;
-
-absolute_time_t inicio_ciclo;
 
 int main() {
     
     setup();  // Inicializações: ADC, DMA, interrupções, OLED, etc.
 
+#if BENCHMARK_NEOPIXEL
+    benchmark_neopixel(100);
+    benchmark_geometria(100);
+#endif
+#if TESTE_EMULADOR_NEOPIXEL
+    teste_emulador_neopixel();
+#endif
+#if BENCHMARK_ESTATISTICAS
+    benchmark_estatisticas(20);
+#endif
+
    // while (!stdio_usb_connected()) {
    //     sleep_ms(100);
    // }
 
-    while (true) {
-        inicio_ciclo = get_absolute_time();
-        tarefa_1();
-        tarefa_2();
-        tarefa_3();
-        tarefa_4();
-        tarefa_5(inicio_ciclo);
-
-        // --- Cálculo dos tempos de execução ---
-        int64_t tempo1_us = absolute_time_diff_us(ini_tarefa1, fim_tarefa1);
-        int64_t tempo2_us = absolute_time_diff_us(ini_tarefa2, fim_tarefa2);
-        int64_t tempo3_us = absolute_time_diff_us(ini_tarefa3, fim_tarefa3);
-        int64_t tempo4_us = absolute_time_diff_us(ini_tarefa4, fim_tarefa4);
-        int64_t tempo5_us = absolute_time_diff_us(ini_tarefa5, fim_tarefa5);
-
-
-        // --- Exibição no terminal ---
-        printf("Temperatura: %.2f °C | T1: %.3fs | T2: %.3fs | T3: %.3fs | T4: %.3fs | T5: %.3fs | Tendência: %s\n",
-               media,
-               tempo1_us / 1e6,
-               tempo2_us / 1e6,
-               tempo3_us / 1e6,
-               tempo4_us / 1e6,
-               tempo5_us / 1e6,
-               tendencia_para_texto(t));
-
-        //sleep_ms(1000);  // Aguarda próximo ciclo
+    // A primeira média espera a primeira metade do ADC (~1 s); fora do executor,
+    // para não atrasar os quadros
+    media = tarefa1_obter_media_temp();
+
+    if (executor_inicia(tarefas, NUM_TAREFAS) != EXECUTOR_OK) {
+        while (true) {
+            tight_loop_contents();
+        }
     }
+    executor_executa();
 
     return 0;
 }
 
+// Os tempos de cada tarefa vêm do rastro (trace.c), gravado pelo executor na entrada
+// e na saída: as tarefas não medem mais o próprio tempo.
+
 /*******************************/
 void tarefa_1()
 {
-// --- Tarefa 1: Leitura de temperatura via DMA ---
-        ini_tarefa1 = get_absolute_time();
-        media = tarefa1_obter_media_temp(&cfg_temp, DMA_TEMP_CHANNEL);
-        fim_tarefa1 = get_absolute_time();
+    // --- Tarefa 1: Leitura de temperatura via DMA ---
+    media = tarefa1_obter_media_temp();
+}
+/*******************************/
+void tarefa_1_fases()
+{
+    // --- Tarefa 1 em fases: pega a metade do ADC assim que fica pronta, ---
+    // --- acumula um trecho por quadro e publica a média ao terminar    ---
+    tarefa1_inicia();
+    if (tarefa1_acumula()) {
+        media = tarefa1_conclui();
+    }
 }
 /*******************************/
 void tarefa_2()
 {
     // --- Tarefa 3: Análise da tendência térmica ---
-        ini_tarefa3 = get_absolute_time();
-        t = tarefa3_analisa_tendencia(media);
-        fim_tarefa3 = get_absolute_time();
+    t = tarefa3_analisa_tendencia(media);
 }
 /*******************************/
 void tarefa_3()
 {
-        // --- Tarefa 2: Exibição no OLED ---
-        ini_tarefa2 = get_absolute_time();
-        tarefa2_exibir_oled(media, t);
-        fim_tarefa2 = get_absolute_time();
+    // --- Tarefa 2: Exibição no OLED ---
+    tarefa2_exibir_oled(media, t);
 }
 /*******************************/
 void tarefa_4()
 {
-// --- Tarefa 4: Cor da matriz NeoPixel por tendência ---
-        absolute_time_t ini_tarefa4 = get_absolute_time();
-        tarefa4_matriz_cor_por_tendencia(t);
-        absolute_time_t fim_tarefa4 = get_absolute_time();
+    // --- Tarefa 4: Cor da matriz NeoPixel por tendência ---
+    tarefa4_matriz_cor_por_tendencia(t);
 }
-void tarefa_5(absolute_time_t inicio_ciclo)
+/*******************************/
+void tarefa_5()
 {
-    ini_tarefa5 = get_absolute_time();
-    // --- Tarefa 5: análise por blocos com deadline + LED RGB GPIO ---
-    tarefa5_movel_com_deadline(media, inicio_ciclo);  // Essa chamada já inclui controle de tempo
-    fim_tarefa5 = get_absolute_time();
-}
\ No newline at end of file
+    // --- Tarefa 5: LED RGB GPIO pela tendência da amostra ---
+    tarefa5_movel(t);
+}
+/*******************************/
+void tarefa_anima()
+{
+    // --- Animação da matriz NeoPixel (tarefa rápida) ---
+    tarefa4_anima();
+}
+/*******************************/
+void tarefa_relatorio()
+{
+    static uint32_t ciclos = 0;
+
+    printf("Temperatura: %.2f °C | Tendência: %s\n", media, tendencia_para_texto(t));
+
+    // --- Executor: pior tempo e estouros de orçamento por tarefa, a cada 10 s ---
+    if (++ciclos % 10 != 0) {
+        return;
+    }
+    // (execução máxima / orçamento, estouros, resposta máxima desde a abertura do quadro)
+    printf("[EXECUTOR] Utilização: %.2f%% | quadros atrasados: %lu | metades perdidas: %lu\n",
+           executor_utilizacao(), (unsigned long)executor_quadros_atrasados(),
+           (unsigned long)tarefa1_metades_perdidas());
+    for (uint32_t i = 0; i < NUM_TAREFAS; i++) {
+        const executor_estat_t *e = executor_estatisticas(i);
+        printf("  %-10s %5lu/%5lu us (%lu) resp. %lu us\n", tarefas[i].nome,
+               (unsigned long)e->max_us, (unsigned long)tarefas[i].orcamento_us,
+               (unsigned long)e->estouros, (unsigned long)e->resposta_max_us);
+    }
+}
+/*******************************/
+void tarefa_trace()
+{
+    // --- Descarga do rastro de execução em bloco pela USB ---
+    trace_descarrega();
+}
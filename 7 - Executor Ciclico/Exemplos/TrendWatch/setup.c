@@ -9,8 +9,9 @@
  *      
  *      - Inicialização do terminal USB (stdio)
  *      - Configuração do ADC e habilitação do sensor interno
- *      - Configuração do canal DMA para leitura da temperatura
- *      - Registro da interrupção do canal DMA 0
+ *      - Reserva dos canais DMA da temperatura e início da
+ *        aquisição contínua (ping-pong)
+ *      - Registro da interrupção dos canais DMA 0 e 1
  *      - Inicialização do display OLED (SSD1306)
  *
  *      A função principal `setup()` deve ser chamada uma única
@@ -19,8 +20,8 @@
  *      antes de iniciar o executor cíclico.
  *
  *  Relacionamento:
- *      - Define a configuração global `cfg_temp` para uso
- *        posterior na Tarefa 1 (tarefa1_temp.c)
+ *      - Inicia a aquisição contínua da Tarefa 1
+ *        (tarefa1_inicia_aquisicao(), em tarefa1_temp.c)
  *      - Define os símbolos globais `ssd[]` e `area` usados na
  *        Tarefa 2 (tarefa2_display.c)
  *      - Utiliza o handler de interrupção definido em
@@ -42,7 +43,9 @@
 #include "hardware/i2c.h"
 #include "pico/binary_info.h"
 #include "neopixel_driver.h"
+#include "np_anim.h"
 #include "funcao_do_projeto.h"  // onde LED_VERMELHO, LED_VERDE, LED_AZUL estão definidos
+#include "tarefa1_temp.h"
 
 // === Buffer de vídeo do OLED (tela de 128 x 64) ===
 uint8_t ssd[ssd1306_buffer_length];
@@ -55,14 +58,11 @@ struct render_area area = {
     .end_page = ssd1306_n_pages - 1
 };
 
-// === Configuração global do canal DMA 0 ===
-dma_channel_config cfg_temp;
-
 /**
  * @brief Realiza a configuração inicial do sistema.
  *
  * Esta função inicializa o terminal USB, ADC, sensor de temperatura,
- * canal DMA 0, interrupções e o display OLED.
+ * canais DMA 0 e 1, interrupções e o display OLED.
  */
 void setup() {
     // Inicializa a comunicação USB para printf()
@@ -73,17 +73,15 @@ void setup() {
     adc_init();
     adc_set_temp_sensor_enabled(true);
 
-    // Configura o canal DMA 0 para transferir dados do ADC
-    cfg_temp = dma_channel_get_default_config(DMA_TEMP_CHANNEL);
-    channel_config_set_transfer_data_size(&cfg_temp, DMA_SIZE_16);  // 16 bits
-    channel_config_set_read_increment(&cfg_temp, false);            // ADC FIFO fixo
-    channel_config_set_write_increment(&cfg_temp, true);            // Buffer se move
-    channel_config_set_dreq(&cfg_temp, DREQ_ADC);                   // dispara com ADC
+    // Reserva os canais DMA 0 e 1 para o ping-pong do ADC
+    // (para que o canal do NeoPixel em npInit() não caia neles)
+    dma_channel_claim(DMA_TEMP_CHANNEL);
+    dma_channel_claim(DMA_TEMP_CHANNEL_B);
 
-    // Configura interrupção do canal DMA 0
-    dma_channel_set_irq0_enabled(DMA_TEMP_CHANNEL, true);
+    // Configura a interrupção dos canais DMA 0 e 1 e inicia a aquisição contínua
     irq_set_exclusive_handler(DMA_IRQ_0, dma_handler_temp);
     irq_set_enabled(DMA_IRQ_0, true);
+    tarefa1_inicia_aquisicao();
 
     // Inicializa o display OLED SSD1306 via I2C
     i2c_init(i2c1, 400 * 1000);  // <---I2C primeiro
@@ -97,6 +95,7 @@ void setup() {
 
     // Inicializa NeoPixel (Matriz RGB)
     npInit(LED_PIN);  // substitua LED_PIN pelo valor real, ex: 7
+    np_anim_init(NP_ANIM_FPS);
 
         // --- Configuração do LED RGB discreto (GPIO) ---
     gpio_init(LED_VERMELHO);
@@ -3,9 +3,8 @@
 
 #include "hardware/dma.h"
 
-#define DMA_TEMP_CHANNEL 0
-
-extern dma_channel_config cfg_temp;
+#define DMA_TEMP_CHANNEL 0     // Ping-pong da temperatura: metade A
+#define DMA_TEMP_CHANNEL_B 1   // Ping-pong da temperatura: metade B
 
 void setup(void);
 
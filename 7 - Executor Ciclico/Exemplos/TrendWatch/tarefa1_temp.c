@@ -5,26 +5,42 @@
  * ------------------------------------------------------------
  *  Descrição:
  *      Este módulo implementa a Tarefa 1 do executor cíclico,
- *      responsável por realizar a leitura do sensor interno
- *      de temperatura utilizando ADC + DMA, durante um intervalo
- *      contínuo de 0,5 segundos.
+ *      responsável pela leitura do sensor interno de temperatura
+ *      utilizando ADC + DMA em aquisição contínua.
  *
- *      A leitura é feita em blocos menores (10.000 amostras)
- *      para evitar o uso excessivo da SRAM do RP2040. Cada
- *      bloco é transferido via DMA e processado de forma
- *      incremental para obter a média da temperatura ao final
- *      do intervalo total.
+ *      O ADC roda livre a TEMP_TAXA_HZ amostras por segundo e dois
+ *      canais DMA, encadeados um ao outro, enchem as duas metades
+ *      de um buffer ping-pong sem parar: quando o canal A termina
+ *      a sua metade, dispara o canal B, e vice-versa. O endereço de
+ *      escrita de cada canal dá a volta sozinho (ring de escrita),
+ *      então nada precisa ser reprogramado entre as metades e não
+ *      há intervalo sem amostragem entre os blocos.
+ *
+ *      A tarefa não espera pela aquisição e é dividida em fases
+ *      de custo limitado, para o executor intercalar outras
+ *      tarefas entre elas: início (escolhe a metade pronta),
+ *      acumulação (TEMP_TRECHO amostras por chamada) e conclusão
+ *      (publica a média). O DMA volta a escrever numa metade
+ *      TEMP_METADE / TEMP_TAXA_HZ (~1 s) depois de terminá-la; no
+ *      executor as fases rodam a cada quadro de 20 ms, então a
+ *      leitura começa no máximo um quadro depois de a metade
+ *      ficar pronta e termina 8 quadros depois, bem antes disso.
+ *      Uma metade alcançada pelo DMA durante a leitura (tarefa
+ *      atrasada) é descartada, sem publicar a média.
  *
  *  Funcionalidades:
- *      - Converte valores brutos do ADC para graus Celsius.
- *      - Controla o tempo de aquisição com precisão usando
- *        o clock interno via 'get_absolute_time()'.
- *      - Utiliza DMA canal 0 e depende da flag 'dma_temp_done'
- *        sinalizada pelo handler definido em 'irq_handlers.c'.
+ *      - Estatísticas do bloco (média, desvio, mediana, ...) sobre
+ *        os códigos brutos, em inteiros (estatisticas_adc.c); só o
+ *        resultado é convertido para graus Celsius.
+ *      - Conta metades perdidas: puladas (tarefa atrasada mais de
+ *        uma metade) ou descartadas por terem sido sobrescritas.
+ *      - Depende do contador 'dma_temp_metades', incrementado pelo
+ *        handler definido em 'irq_handlers.c'.
  *
  *  Relacionamento:
  *      - Chamado pelo laço principal em 'main.c' como tarefa do ciclo.
- *      - Requer configuração do canal DMA e IRQ em 'setup.c'.
+ *      - Canais DMA e IRQ reservados em 'setup.c', que também chama
+ *        tarefa1_inicia_aquisicao().
  *
  *  
  *  Data: 11/05/2025
@@ -36,73 +52,178 @@
 #include "hardware/dma.h"
 #include "hardware/sync.h"
 #include "tarefa1_temp.h"
+#include "irq_handlers.h"
+#include "setup.h"
+#include "estatisticas_adc.h"
+
+#if (TEMP_METADE & (TEMP_METADE - 1)) != 0
+#error "TEMP_METADE precisa ser potência de 2 (ring de escrita do DMA)"
+#endif
+
+#define BYTES_METADE (TEMP_METADE * sizeof(uint16_t))
 
-#define BLOCO_AMOSTRAS 10000
-#define DURACAO_AMOSTRAGEM_US 500000  // 0,5 segundos em microssegundos
+// Duas metades contíguas; o alinhamento ao tamanho de uma metade permite o ring de escrita
+static uint16_t buffer_temp[2][TEMP_METADE] __attribute__((aligned(BYTES_METADE)));
 
-static uint16_t buffer_temp[BLOCO_AMOSTRAS];
-extern volatile bool dma_temp_done;
+static uint32_t metades_lidas = 0;
+static uint32_t metades_perdidas = 0;
+static float ultima_media = 0.0f;
+
+// Fases: a metade em processamento e quantas amostras dela já foram acumuladas
+static const uint16_t *metade_em_curso = NULL;
+static uint32_t contagem_em_curso;   // Valor de dma_temp_metades quando a metade ficou pronta
+static uint32_t acumuladas;
+
+// Estatísticas publicadas (última metade concluída) e as da metade em processamento
+static estat_adc_t estat[2];
+static estat_adc_t *estat_publicada = &estat[0];
+static estat_adc_t *estat_em_curso = &estat[1];
 
 /**
- * @brief Converte valor do ADC para temperatura em °C.
- * 
- * @param raw Valor bruto de 12 bits lido do ADC.
- * @return float Temperatura em graus Celsius.
+ * @brief Configura um dos canais do ping-pong: escreve na sua metade (com volta
+ *        automática ao início) e, ao terminar, dispara o outro canal.
  */
-static float convert_to_celsius(uint16_t raw) {
-    const float conv = 3.3f / (1 << 12);  // Conversão para tensão
-    float voltage = raw * conv;
-    return 27.0f - (voltage - 0.706f) / 0.001721f;
+static void configura_canal(int canal, int outro, uint16_t *metade) {
+    dma_channel_config cfg = dma_channel_get_default_config(canal);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);     // 16 bits
+    channel_config_set_read_increment(&cfg, false);               // ADC FIFO fixo
+    channel_config_set_write_increment(&cfg, true);               // Buffer se move
+    channel_config_set_ring(&cfg, true, __builtin_ctz(BYTES_METADE)); // ...e volta ao início da metade
+    channel_config_set_dreq(&cfg, DREQ_ADC);                      // dispara com ADC
+    channel_config_set_chain_to(&cfg, outro);
+
+    dma_channel_configure(canal, &cfg, metade, &adc_hw->fifo, TEMP_METADE, false);
+    dma_channel_set_irq0_enabled(canal, true);
 }
 
 /**
- * @brief Inicia uma transferência via DMA de um bloco do sensor de temperatura.
- *
- * @param buffer Buffer de destino.
- * @param cfg Configuração do canal DMA.
- * @param dma_chan Canal DMA utilizado.
+ * @brief Inicia a aquisição contínua: ADC livre a TEMP_TAXA_HZ e os dois canais DMA
+ *        revezando as metades do buffer. Chamada uma vez, em setup().
  */
-static void iniciar_dma_temp(uint16_t *buffer, dma_channel_config *cfg, int dma_chan) {
+void tarefa1_inicia_aquisicao(void) {
     adc_select_input(4);           // Canal 4 → sensor interno
-    adc_fifo_drain();
     adc_run(false);
+    adc_fifo_drain();
     adc_fifo_setup(true, true, 1, false, false);
+    adc_set_clkdiv(48000000.0f / TEMP_TAXA_HZ - 1.0f);   // Uma conversão a cada (1 + div) ciclos de 48 MHz
+
+    configura_canal(DMA_TEMP_CHANNEL, DMA_TEMP_CHANNEL_B, buffer_temp[0]);
+    configura_canal(DMA_TEMP_CHANNEL_B, DMA_TEMP_CHANNEL, buffer_temp[1]);
+
+    dma_channel_start(DMA_TEMP_CHANNEL);
     adc_run(true);
+}
 
-    dma_channel_configure(
-        dma_chan,
-        cfg,
-        buffer, &adc_hw->fifo,
-        BLOCO_AMOSTRAS,
-        true
-    );
+/**
+ * @brief Fase 1 (início): escolhe a metade mais recente que ficou pronta desde a
+ *        última vez e zera as estatísticas em curso. Custo constante.
+ *
+ * Se mais de uma metade ficou pronta, as mais antigas já estão sendo sobrescritas pelo
+ * DMA e são contadas como perdidas.
+ *
+ * @return true se há uma metade nova para acumular.
+ */
+bool tarefa1_inicia(void) {
+    uint32_t completas = dma_temp_metades;
+    if (completas == metades_lidas || metade_em_curso != NULL) {
+        return false;
+    }
+    metades_perdidas += completas - metades_lidas - 1;
+    metades_lidas = completas;
+
+    // O canal A termina as metades ímpares da contagem (1ª, 3ª, ...), o B as pares
+    metade_em_curso = buffer_temp[(completas - 1) & 1];
+    contagem_em_curso = completas;
+    acumuladas = 0;
+
+    // Histograma centrado na mediana do bloco anterior (no primeiro, na primeira amostra)
+    estat_adc_inicia(estat_em_curso, estat_publicada->n ? estat_adc_percentil(estat_publicada, 50)
+                                                        : metade_em_curso[0]);
+    return true;
 }
 
 /**
- * @brief Executa a Tarefa 1 do executor cíclico: coleta de temperatura por 0,5s.
+ * @brief Fase 2 (acumulação): soma no máximo TEMP_TRECHO amostras da metade em curso.
  *
- * @param cfg_temp Configuração do canal DMA.
- * @param dma_chan Número do canal DMA utilizado.
- * @return float Temperatura média calculada ao final do intervalo.
+ * @return true quando a metade inteira já foi acumulada (ou não há metade em curso).
  */
-float tarefa1_obter_media_temp(dma_channel_config* cfg_temp, int dma_chan) {
-    float soma = 0.0f;
-    uint32_t total_amostras = 0;
+bool tarefa1_acumula(void) {
+    if (metade_em_curso == NULL) {
+        return true;
+    }
+    // O DMA já voltou a esta metade: o resto não vale mais nada (tarefa1_conclui() descarta)
+    if (dma_temp_metades != contagem_em_curso) {
+        acumuladas = TEMP_METADE;
+        return true;
+    }
+    uint32_t n = TEMP_METADE - acumuladas;
+    if (n > TEMP_TRECHO) {
+        n = TEMP_TRECHO;
+    }
+    estat_adc_acumula(estat_em_curso, metade_em_curso + acumuladas, n);
+    acumuladas += n;
+    return acumuladas == TEMP_METADE;
+}
 
-    absolute_time_t inicio = get_absolute_time();
+/**
+ * @brief Fase 3 (conclusão): publica a média da metade acumulada, convertida para °C.
+ *
+ * Sem metade concluída, ou se o DMA a sobrescreveu durante a leitura, devolve a média
+ * anterior. Custo constante.
+ *
+ * @return float Temperatura média da última metade concluída.
+ */
+float tarefa1_conclui(void) {
+    if (metade_em_curso == NULL || acumuladas < TEMP_METADE) {
+        return ultima_media;
+    }
 
-    while (absolute_time_diff_us(inicio, get_absolute_time()) < DURACAO_AMOSTRAGEM_US) {
-        dma_temp_done = false;
-        iniciar_dma_temp(buffer_temp, cfg_temp, dma_chan);
-        while (!dma_temp_done) __wfi();  // Aguarda fim do DMA
-        adc_run(false); // Desliga o ADC
+    metade_em_curso = NULL;
 
-        for (int i = 0; i < BLOCO_AMOSTRAS; i++) {
-            soma += convert_to_celsius(buffer_temp[i]);
-        }
+    // Se outra metade terminou enquanto esta era lida, o DMA já voltou a escrever nela:
+    // as amostras misturam dois blocos e a média não é publicada
+    if (dma_temp_metades != contagem_em_curso) {
+        metades_perdidas++;
+        return ultima_media;
+    }
 
-        total_amostras += BLOCO_AMOSTRAS;
+    estat_adc_t *troca = estat_publicada;
+    estat_publicada = estat_em_curso;
+    estat_em_curso = troca;
+
+    ultima_media = estat_adc_celsius(estat_adc_media(estat_publicada));
+    return ultima_media;
+}
+
+/**
+ * @brief Executa a Tarefa 1 de uma vez: as três fases em seguida.
+ *
+ * Se nenhuma metade nova ficou pronta, devolve a média anterior sem esperar; só a
+ * primeira chamada aguarda (em __wfi) a primeira metade.
+ *
+ * @return float Temperatura média da metade processada.
+ */
+float tarefa1_obter_media_temp(void) {
+    while (dma_temp_metades == 0) __wfi();  // Partida: aguarda a primeira metade
+
+    if (tarefa1_inicia()) {
+        while (!tarefa1_acumula()) {
+        }
     }
+    return tarefa1_conclui();
+}
 
-    return soma / total_amostras;
-}
\ No newline at end of file
+/**
+ * @brief Metades que o DMA sobrescreveu antes de a tarefa terminar de lê-las
+ *        (puladas ou descartadas).
+ */
+uint32_t tarefa1_metades_perdidas(void) {
+    return metades_perdidas;
+}
+
+/**
+ * @brief Estatísticas (em códigos do ADC) da última metade concluída.
+ */
+const estat_adc_t *tarefa1_estatisticas(void) {
+    return estat_publicada;
+}
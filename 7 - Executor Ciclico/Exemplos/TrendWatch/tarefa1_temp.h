@@ -1,8 +1,23 @@
 #ifndef TAREFA1_TEMP_H
 #define TAREFA1_TEMP_H
 
-#include "hardware/dma.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "estatisticas_adc.h"
 
-float tarefa1_obter_media_temp(dma_channel_config* cfg, int dma_chan);
+#define TEMP_TAXA_HZ 4000     // Amostras por segundo do ADC (livre, adc_set_clkdiv)
+#define TEMP_METADE 4096      // Amostras por metade do ping-pong (~1 s, potência de 2)
+#define TEMP_TRECHO 512       // Amostras acumuladas por chamada de tarefa1_acumula()
 
-#endif
\ No newline at end of file
+void tarefa1_inicia_aquisicao(void);
+float tarefa1_obter_media_temp(void);
+
+// Fases da Tarefa 1 (ver tarefa1_temp.c)
+bool tarefa1_inicia(void);
+bool tarefa1_acumula(void);
+float tarefa1_conclui(void);
+
+uint32_t tarefa1_metades_perdidas(void);
+const estat_adc_t *tarefa1_estatisticas(void);
+
+#endif
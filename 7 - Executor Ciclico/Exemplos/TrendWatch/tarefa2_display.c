@@ -11,6 +11,16 @@
  *
  *      Ambas centralizadas horizontalmente, usando fonte padrão.
  *
+ *      A tela é composta por widgets em modo retido
+ *      (oled_widgets.h): a cada ciclo só os widgets cujo valor
+ *      mudou são redesenhados, e render_on_display() envia
+ *      apenas as colunas alteradas. Uma variação de 0,1 °C
+ *      redesenha um único dígito grande.
+ *
+ *      Entre o título e o valor, um gráfico de histórico
+ *      (oled_sparkline.h) recebe uma amostra por ciclo e
+ *      desenha só uma coluna nova.
+ *
  *  
  *  Data: 12/05/2025
  * ------------------------------------------------------------
@@ -19,40 +29,53 @@
 #include <stdio.h>
 #include <string.h>
 #include "ssd1306.h"
-#include "display_utils.h"
+#include "oled_widgets.h"
+#include "oled_sparkline.h"
 #include "tarefa2_display.h"
 #include "tarefa3_tendencia.h"
 
 extern uint8_t ssd[];
 extern struct render_area area;
 
-void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia) {
+// Layout fixo da tela (x, página, largura)
+static oled_widget_t w_titulo;      // "Temperatura"    página 0
+static sparkline_t grafico;         // Histórico        páginas 1 a 3
+static oled_widget_t w_media;       // "Media"          página 4
+static oled_widget_t w_valor;       // +23.4oC (grande) páginas 5 e 6
+static oled_widget_t w_tendencia;   // "TEMP: SUBINDO"  página 7
+static bool tela_montada = false;
+
+static void monta_tela(void) {
     ssd1306_clear_display(ssd);
-    render_on_display(ssd, &area);  // Garante que a limpeza seja visível
-    sleep_ms(20);                   // Pequeno delay opcional
 
-    char* linha1 = "Temperatura";
-    char* linha2 = "Media";
-    char linha3[30];
+    widget_rotulo(&w_titulo, 0, 0, ssd1306_width, WIDGET_CENTRO);
+    sparkline_inicia(&grafico, 0, 1, ssd1306_width, 3);
+    widget_rotulo(&w_media, 0, 4, ssd1306_width, WIDGET_CENTRO);
+    // A fonte grande ocupa só as 16 primeiras linhas (o ponto desce até a 15): 2 páginas bastam
+    widget_numero_grande(&w_valor, 0, 5, ssd1306_width, 2, WIDGET_DIREITA);
+    widget_rotulo(&w_tendencia, 0, 7, ssd1306_width, WIDGET_ESQUERDA);
 
-    snprintf(linha3, sizeof(linha3), "TEMP: %s", tendencia_para_texto(tendencia));
+    widget_texto(&w_titulo, ssd, "Temperatura");
+    widget_texto(&w_media, ssd, "Media");
 
-    // Fonte padrão: 6 px por caractere, altura: 8 px
-    int x1 = (128 - strlen(linha1) * 6) / 2;
-    int x2 = (128 - strlen(linha2) * 6) / 2;
-    int x3 = (128 - strlen(linha3) * 6) / 2;
+    tela_montada = true;
+}
+
+void tarefa2_exibir_oled(float temperatura, tendencia_t tendencia) {
+    if (!tela_montada) {
+        monta_tela();
+    }
 
-    // Y = linha × altura da fonte (8 px padrão)
-    ssd1306_draw_string(ssd, x1, 0, linha1);    // Linha 0 (Y=0)
-    // Linha 1 = em branco (Y=8)
-    ssd1306_draw_string(ssd, x2, 16, linha2);   // Linha 2 (Y=16)
-    // Linha 3 = em branco (Y=24)
+    char valor[16];
+    char linha3[30];
 
-    // Fonte grande começa abaixo: Y=32 px
-    mostrar_valor_grande(ssd, temperatura, 32);
+    snprintf(valor, sizeof(valor), "%+.1foC", temperatura);
+    snprintf(linha3, sizeof(linha3), "TEMP: %s", tendencia_para_texto(tendencia));
 
-    ssd1306_draw_string(ssd, 0, 56, linha3);  // Y = 32 
+    sparkline_adiciona(&grafico, ssd, temperatura);
+    widget_texto(&w_valor, ssd, valor);
+    widget_texto(&w_tendencia, ssd, linha3);
 
+    // Envia apenas as colunas que mudaram desde o último ciclo
     render_on_display(ssd, &area);
 }
-
@@ -7,18 +7,21 @@
  *      Este módulo implementa a Tarefa 3 do executor cíclico:
  *      a análise de tendência da temperatura.
  *      
- *      A função compara a temperatura atual com a anterior
- *      e classifica como:
+ *      Cada média de temperatura entra no detector por janelas
+ *      (tendencia_janelas.c): inclinação por mínimos quadrados
+ *      em janelas de 10, 30 e 60 amostras, com histerese, em
+ *      O(1) por amostra. Antes a amostra era comparada só com
+ *      a anterior (±0,01 °C), o que trocava de estado a cada
+ *      ruído do sensor. Classifica como:
  *          - TENDÊNCIA_SUBINDO
  *          - TENDÊNCIA_CAINDO
  *          - TENDÊNCIA_ESTÁVEL
  *
- *      A tendência é detectada com base em um limiar mínimo
- *      de variação (±0.05°C) e pode ser exibida no terminal
- *      ou no display OLED.
+ *      A tendência pode ser exibida no terminal ou no display
+ *      OLED.
  * 
  *  Funcionalidades:
- *      - Armazena a última temperatura registrada
+ *      - Mantém o detector de tendência (uma amostra por ciclo)
  *      - Retorna enum `tendencia_t` representando o estado
  *      - Oferece função auxiliar para converter enum em string
  *
@@ -32,29 +35,21 @@
  */
 
 #include "tarefa3_tendencia.h"
+#include "tendencia_janelas.h"
 
-static float temperatura_anterior = 0.0f;
+static tend_detector_t detector;
 static int primeiro_ciclo = 1;
 
 tendencia_t tarefa3_analisa_tendencia(float atual) {
-    tendencia_t resultado;
-
     if (primeiro_ciclo) {
-        resultado = TENDENCIA_ESTAVEL;
+        tend_inicia(&detector);
         primeiro_ciclo = 0;
-    } else {
-        float delta = atual - temperatura_anterior;
-
-        if (delta > 0.01f)
-            resultado = TENDENCIA_SUBINDO;
-        else if (delta < -0.01f)
-            resultado = TENDENCIA_CAINDO;
-        else
-            resultado = TENDENCIA_ESTAVEL;
     }
+    return tend_adiciona(&detector, atual);
+}
 
-    temperatura_anterior = atual;
-    return resultado;
+const tend_detector_t *tarefa3_detector(void) {
+    return &detector;
 }
 
 const char* tendencia_para_texto(tendencia_t t) {
@@ -32,13 +32,20 @@ typedef enum {
 } tendencia_t;
 
 /**
- * @brief Analisa a tendência com base na temperatura atual e anterior.
+ * @brief Acrescenta a temperatura atual ao detector por janelas
+ *        (tendencia_janelas.h) e devolve a tendência decidida.
  *
- * @param atual Temperatura atual (ºC)
+ * @param atual Temperatura atual (ºC), uma vez por ciclo
  * @return tendência identificada
  */
 tendencia_t tarefa3_analisa_tendencia(float atual);
 
+/**
+ * @brief Detector usado pela análise (médias, EMA e inclinações por janela).
+ */
+struct tend_detector_t;
+const struct tend_detector_t *tarefa3_detector(void);
+
 /**
  * @brief Converte a tendência para texto ("SUBINDO", "CAINDO", "ESTÁVEL").
  *
@@ -13,12 +13,14 @@
  *         - Tendência ESTÁVEL → matriz toda VERDE
  *         - Tendência CAINDO  → matriz toda AZUL
  *
- *      As cores são aplicadas a todos os LEDs simultaneamente,
- *      utilizando a função npSetAll() do driver de NeoPixels.
+ *      A cor é a camada 0 do motor de animação (np_anim.c). Na
+ *      troca de tendência, a camada 1 pisca em branco por cima
+ *      (alerta). Os quadros saem por DMA e são gerados em
+ *      np_anim_tick(), sem sleep: a tarefa não bloqueia.
  *
  *  Relacionamento:
  *      - Depende de `tarefa3_tendencia.h` para o enum `tendencia_t`
- *      - Usa `neopixel_driver.h` para acionar os LEDs
+ *      - Usa `np_anim.h` (camadas) sobre `neopixel_driver.h`
  *      - Requer definições simbólicas de cores (ex: `COR_AZUL`)
  *
  *  
@@ -27,7 +29,9 @@
  */
 
 #include "neopixel_driver.h"
+#include "np_anim.h"
 #include "tarefa3_tendencia.h"
+#include "tarefa4_controla_neopixel.h"
 #include "testes_cores.h"  // contém COR_AZUL, COR_VERDE, COR_VERMELHO
 
 /**
@@ -36,17 +40,35 @@
  * @param t Tendência térmica detectada (subindo, caindo, estável)
  */
 void tarefa4_matriz_cor_por_tendencia(tendencia_t t) {
+    static bool primeira = true;
+    static tendencia_t anterior;
+
+    if (!np_anim_ativa(0)) {
+        np_anim_inicia(0, NP_ANIM_COR_FIXA, COR_APAGA, COR_APAGA, COR_APAGA, 1000, NP_MISTURA_SUBSTITUI, 0);
+    }
+
     switch (t) {
         case TENDENCIA_CAINDO:
-            npSetAll(COR_AZUL);     // Azul
+            np_anim_cor(0, COR_AZUL);     // Azul
             break;
         case TENDENCIA_ESTAVEL:
-            npSetAll(COR_VERDE);    // Verde
+            np_anim_cor(0, COR_VERDE);    // Verde
             break;
         case TENDENCIA_SUBINDO:
-            npSetAll(COR_VERMELHO); // Vermelho
+            np_anim_cor(0, COR_VERMELHO); // Vermelho
             break;
     }
 
-    npWrite();  // Atualiza fisicamente a matriz
+    // Alerta: três piscadas em branco quando a tendência muda
+    if (!primeira && t != anterior) {
+        np_anim_inicia(1, NP_ANIM_PISCA, COR_BRANCA, 150, NP_MISTURA_SUBSTITUI, 3);
+    }
+    primeira = false;
+    anterior = t;
+
+    np_anim_tick(get_absolute_time());
+}
+
+void tarefa4_anima(void) {
+    np_anim_tick(get_absolute_time());
 }
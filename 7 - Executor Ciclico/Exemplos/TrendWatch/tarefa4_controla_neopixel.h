@@ -23,6 +23,7 @@
 #ifndef TAREFA4_CONTROLA_NEOPIXEL_H
 #define TAREFA4_CONTROLA_NEOPIXEL_H
 
+#include "pico/time.h"
 #include "tarefa3_tendencia.h"  // para o tipo tendencia_t
 
 #ifdef __cplusplus
@@ -36,6 +37,12 @@ extern "C" {
  */
 void tarefa4_matriz_cor_por_tendencia(tendencia_t t);
 
+/**
+ * @brief Avança as animações da matriz (no máximo um quadro por chamada).
+ *        Tarefa periódica rápida do executor cíclico.
+ */
+void tarefa4_anima(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,31 +4,30 @@
  *  Projeto: TempCycleDMA / TrendWatch
  * ------------------------------------------------------------
  *  Descrição geral:
- *      Esta tarefa executa uma análise térmica com média móvel
- *      em blocos (TAM_BLOCO = 50), verificando a tendência da
- *      temperatura (subindo, caindo, estável).
- *
- *      A cada novo valor médio (vindo da Tarefa 1), ele é armazenado.
- *      Ao completar o bloco, calcula-se a média do bloco atual e
- *      compara-se com o bloco anterior:
+ *      Esta tarefa mostra a tendência da temperatura no LED RGB
+ *      discreto (GPIO) a cada nova amostra:
  *         - Se subiu → LED vermelho (GPIO)
  *         - Se caiu  → LED azul (GPIO)
  *         - Se manteve → LED verde (GPIO)
  *
- *      A grande inovação aqui é o controle de tempo absoluto.
- *      A tarefa calcula o tempo restante após as Tarefas 1 a 4
- *      e espera exatamente o necessário para que o ciclo completo
- *      dure sempre 1000 ms (1 segundo).
+ *      A decisão vem do detector por janelas da Tarefa 3
+ *      (tendencia_janelas.c), atualizado em O(1) por amostra.
+ *      Antes a tarefa guardava blocos de 50 médias e só decidia
+ *      ao fechar cada bloco (uma vez a cada 50 s, com atraso de
+ *      até 100 s). Na troca de tendência imprime a inclinação
+ *      de cada janela em °C/min.
  *
- *      Isso garante um sistema determinístico e sincronizado,
- *      como um relógio embarcado, sem acúmulo de atrasos.
+ *      O prazo de 1 s não é mais controlado aqui: a tarefa roda
+ *      no seu quadro do executor cíclico (executor_ciclico.c),
+ *      liberada pelo alarme de hardware uma vez por segundo, e
+ *      a animação da matriz é uma tarefa própria de 50 Hz.
+ *      O monitor mostra o intervalo real entre execuções.
  *
  *  Conceitos didáticos envolvidos:
- *      - Média móvel por blocos (filtro por estabilidade)
+ *      - Janelas deslizantes com histerese (filtro por estabilidade)
  *      - Análise de tendência térmica
  *      - Controle de LED RGB discreto via GPIO
- *      - Precisão de tempo com busy_wait_until()
- *      - Deadline ajustado conforme tempo das tarefas anteriores
+ *      - Liberação periódica pelo executor cíclico
  *
  *  
  *  Data: 2024
@@ -40,64 +39,24 @@
 #include "tarefa5_movel_gpio_deadline.h"
 #include "funcao_do_projeto.h"
 #include "tarefa3_tendencia.h"
+#include "tendencia_janelas.h"
 
-#define TAM_BLOCO 50
-#define LIMIAR_TENDENCIA 0.05f
-#define INTERVALO_US 1000000  // 1 segundo em microssegundos
-
-static float buffer[TAM_BLOCO];
-static int indice = 0;
-static float media_anterior = 0.0f;
+static tendencia_t tendencia_anterior = TENDENCIA_ESTAVEL;
 
-void tarefa5_movel_com_deadline(float nova_media, absolute_time_t inicio_ciclo) {
+void tarefa5_movel(tendencia_t tendencia) {
     static absolute_time_t tempo_anterior;
-    buffer[indice++] = nova_media;
-
-    printf("[Bloco] Progresso: %d / %d\n", indice, TAM_BLOCO);
-
-    if (indice >= TAM_BLOCO) {
-        float soma = 0;
-        for (int i = 0; i < TAM_BLOCO; i++) {
-            soma += buffer[i];
-        }
-        float media_atual = soma / TAM_BLOCO;
-
-        float delta = media_atual - media_anterior;
-        tendencia_t tendencia_detectada = TENDENCIA_ESTAVEL;
-
-        if (media_anterior != 0.0f) {
-            if (delta > LIMIAR_TENDENCIA) {
-                gpio_put(LED_VERMELHO, 1);
-                gpio_put(LED_VERDE, 0);
-                gpio_put(LED_AZUL, 0);
-                tendencia_detectada = TENDENCIA_SUBINDO;
-            } else if (delta < -LIMIAR_TENDENCIA) {
-                gpio_put(LED_VERMELHO, 0);
-                gpio_put(LED_VERDE, 0);
-                gpio_put(LED_AZUL, 1);
-                tendencia_detectada = TENDENCIA_CAINDO;
-            } else {
-                gpio_put(LED_VERMELHO, 0);
-                gpio_put(LED_VERDE, 1);
-                gpio_put(LED_AZUL, 0);
-                tendencia_detectada = TENDENCIA_ESTAVEL;
-            }
-
-            printf("Bloco anterior: %.2f °C | Bloco atual: %.2f °C | Tendência: %s\n",
-                   media_anterior, media_atual, tendencia_para_texto(tendencia_detectada));
-        }
-
-        media_anterior = media_atual;
-        indice = 0;
-    }
 
-    // Cálculo do tempo restante com base no ciclo iniciado no main
-    int64_t tempo_gasto_us = absolute_time_diff_us(inicio_ciclo, get_absolute_time());
-    int64_t tempo_restante_us = INTERVALO_US - tempo_gasto_us;
+    gpio_put(LED_VERMELHO, tendencia == TENDENCIA_SUBINDO);
+    gpio_put(LED_VERDE, tendencia == TENDENCIA_ESTAVEL);
+    gpio_put(LED_AZUL, tendencia == TENDENCIA_CAINDO);
 
-    if (tempo_restante_us > 0) {
-        absolute_time_t proximo_ciclo = delayed_by_us(get_absolute_time(), tempo_restante_us);
-        busy_wait_until(proximo_ciclo);
+    if (tendencia != tendencia_anterior) {
+        const tend_detector_t *d = tarefa3_detector();
+        printf("Tendência: %s -> %s | inclinação %.3f / %.3f / %.3f °C/min (janelas %d/%d/%d s)\n",
+               tendencia_para_texto(tendencia_anterior), tendencia_para_texto(tendencia),
+               tend_inclinacao(d, 0) * 60.0f, tend_inclinacao(d, 1) * 60.0f,
+               tend_inclinacao(d, 2) * 60.0f, TEND_CURTA, TEND_MEDIA, TEND_LONGA);
+        tendencia_anterior = tendencia;
     }
 
     // Monitor de tempo real
@@ -1,13 +1,15 @@
 #ifndef TAREFA5_MOVEL_GPIO_DEADLINE_H
 #define TAREFA5_MOVEL_GPIO_DEADLINE_H
 
+#include "tarefa3_tendencia.h"
+
 /**
- * @brief Executa análise de tendência com média móvel por blocos.
- *        Atualiza o LED RGB via GPIO conforme a tendência.
- *        Controle rigoroso de tempo com busy_wait_until().
+ * @brief Atualiza o LED RGB via GPIO conforme a tendência da amostra
+ *        atual (detector por janelas da Tarefa 3).
+ *        Chamada uma vez por segundo pelo executor cíclico.
  *
- * @param nova_media Valor médio da temperatura no ciclo atual
+ * @param tendencia Tendência decidida no ciclo atual
  */
-void tarefa5_movel_com_deadline(float nova_media, absolute_time_t inicio_ciclo);
+void tarefa5_movel(tendencia_t tendencia);
 
 #endif
@@ -0,0 +1,139 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: tendencia_janelas.c
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Implementa o detector de tendência por janelas (ver
+ *      tendencia_janelas.h).
+ *
+ *      Inclinação por mínimos quadrados com x = 0..n-1:
+ *          b = (n·Sxy - Sx·Sy) / (n·Sxx - Sx²)
+ *      com Sx e Sxx fixos para cada n. Quando a janela está
+ *      cheia e chega uma amostra, todas as antigas andam uma
+ *      posição para trás (x - 1) e a mais antiga (y0) sai:
+ *          Sxy' = Sxy - (Sy - y0) + (n - 1)·y_nova
+ *          Sy'  = Sy - y0 + y_nova
+ *      Enquanto enche: Sxy' = Sxy + n·y_nova, Sy' = Sy + y_nova.
+ *      Syy (soma dos quadrados) dá o resíduo da reta e, com ele,
+ *      o erro padrão da inclinação usado nos limiares.
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#include <string.h>
+#include <math.h>
+#include "tendencia_janelas.h"
+
+#if (TEND_HISTORICO & (TEND_HISTORICO - 1)) != 0 || TEND_HISTORICO <= TEND_LONGA
+#error "TEND_HISTORICO precisa ser potência de 2 e maior que a janela longa"
+#endif
+
+static const uint16_t tamanhos[TEND_JANELAS] = { TEND_CURTA, TEND_MEDIA, TEND_LONGA };
+
+void tend_inicia(tend_detector_t *d) {
+    memset(d, 0, sizeof(*d));
+    for (int j = 0; j < TEND_JANELAS; j++) {
+        d->janela[j].tamanho = tamanhos[j];
+        d->janela[j].alfa_q16 = (int32_t)((2u << 16) / (tamanhos[j] + 1u));
+        d->janela[j].estado = TENDENCIA_ESTAVEL;
+    }
+    d->decisao = TENDENCIA_ESTAVEL;
+}
+
+// Histerese: SUBINDO/CAINDO acima do limiar de entrada, ESTÁVEL abaixo do de saída.
+// Os limiares sobem com o erro padrão da inclinação (sigma_b), para a janela
+// curta não votar com ruído.
+static tendencia_t classifica(tendencia_t estado, float b, float sigma_b) {
+    float entra = fmaxf(TEND_LIMIAR_ENTRA, TEND_Z_ENTRA * sigma_b);
+    float sai = fmaxf(TEND_LIMIAR_SAI, TEND_Z_SAI * sigma_b);
+    switch (estado) {
+        case TENDENCIA_SUBINDO:
+            if (b < -entra) return TENDENCIA_CAINDO;
+            return (b < sai) ? TENDENCIA_ESTAVEL : TENDENCIA_SUBINDO;
+        case TENDENCIA_CAINDO:
+            if (b > entra) return TENDENCIA_SUBINDO;
+            return (b > -sai) ? TENDENCIA_ESTAVEL : TENDENCIA_CAINDO;
+        default:
+            if (b > entra) return TENDENCIA_SUBINDO;
+            if (b < -entra) return TENDENCIA_CAINDO;
+            return TENDENCIA_ESTAVEL;
+    }
+}
+
+static void atualiza_janela(tend_janela_t *w, int32_t y, int32_t y_saindo) {
+    if (w->n < w->tamanho) {
+        w->soma_xy += (int64_t)w->n * y;
+        w->soma += y;
+        w->soma_quad += (int64_t)y * y;
+        w->n++;
+        w->ema_q16 = (w->n == 1) ? ((int64_t)y << 16)
+                                 : w->ema_q16 + ((((int64_t)y << 16) - w->ema_q16) * w->alfa_q16 >> 16);
+    } else {
+        w->soma_xy += -(int64_t)(w->soma - y_saindo) + (int64_t)(w->n - 1) * y;
+        w->soma += y - y_saindo;
+        w->soma_quad += (int64_t)y * y - (int64_t)y_saindo * y_saindo;
+        w->ema_q16 += (((int64_t)y << 16) - w->ema_q16) * w->alfa_q16 >> 16;
+    }
+
+    if (w->n < 2) {
+        w->inclinacao = 0.0f;
+        return;
+    }
+    int64_t n = w->n;
+    int64_t sx = n * (n - 1) / 2;
+    int64_t sxx = (n - 1) * n * (2 * n - 1) / 6;
+    int64_t num = n * w->soma_xy - sx * (int64_t)w->soma;
+    int64_t den = n * sxx - sx * sx;
+    w->inclinacao = (float)num / (float)den;
+
+    // Só a janela cheia vota
+    if (w->n < w->tamanho) {
+        w->estado = TENDENCIA_ESTAVEL;
+        return;
+    }
+    // Resíduo da reta: n·SQres = (n·Syy - Sy²) - num² / den
+    float var_y = (float)(n * w->soma_quad - (int64_t)w->soma * w->soma);
+    float residuo = var_y - (float)num * (float)num / (float)den;
+    float sigma_b = (residuo > 0.0f) ? sqrtf(residuo / (float)(n - 2) / (float)den) : 0.0f;
+    w->estado = classifica(w->estado, w->inclinacao, sigma_b);
+}
+
+tendencia_t tend_adiciona(tend_detector_t *d, float temperatura) {
+    int32_t y = (int32_t)(temperatura * 1000.0f + (temperatura >= 0 ? 0.5f : -0.5f));
+    uint32_t t = d->total;
+
+    int votos_sobe = 0, votos_desce = 0;
+    for (int j = 0; j < TEND_JANELAS; j++) {
+        tend_janela_t *w = &d->janela[j];
+        int32_t y_saindo = d->historico[(t - w->tamanho) & (TEND_HISTORICO - 1)];
+        atualiza_janela(w, y, y_saindo);
+        votos_sobe += (w->estado == TENDENCIA_SUBINDO);
+        votos_desce += (w->estado == TENDENCIA_CAINDO);
+    }
+    d->historico[t & (TEND_HISTORICO - 1)] = y;
+    d->total = t + 1;
+
+    if (votos_sobe >= 2) {
+        d->decisao = TENDENCIA_SUBINDO;
+    } else if (votos_desce >= 2) {
+        d->decisao = TENDENCIA_CAINDO;
+    } else if (votos_sobe == 0 && votos_desce == 0) {
+        d->decisao = TENDENCIA_ESTAVEL;
+    }
+    return d->decisao;
+}
+
+float tend_media(const tend_detector_t *d, int janela) {
+    const tend_janela_t *w = &d->janela[janela];
+    return w->n ? (float)w->soma / w->n / 1000.0f : 0.0f;
+}
+
+float tend_ema(const tend_detector_t *d, int janela) {
+    return (float)(d->janela[janela].ema_q16 / 65536.0) / 1000.0f;
+}
+
+float tend_inclinacao(const tend_detector_t *d, int janela) {
+    return d->janela[janela].inclinacao / 1000.0f;
+}
@@ -0,0 +1,80 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: tendencia_janelas.h
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Detector de tendência da temperatura com várias janelas
+ *      deslizantes (curta, média e longa), atualizado em O(1)
+ *      por amostra. Para cada janela mantém, com somas
+ *      incrementais:
+ *        - média móvel simples (soma das amostras);
+ *        - média móvel exponencial (EMA, alfa = 2 / (N + 1));
+ *        - inclinação por mínimos quadrados (soma de x·y).
+ *
+ *      As amostras são guardadas em m°C (inteiros), então as
+ *      somas são exatas e não acumulam erro com o tempo.
+ *
+ *      Cada janela cheia classifica a própria inclinação com
+ *      histerese: entra em SUBINDO/CAINDO acima de
+ *      TEND_LIMIAR_ENTRA e só volta a ESTÁVEL abaixo de
+ *      TEND_LIMIAR_SAI; os dois limiares crescem com o erro
+ *      padrão da inclinação (resíduo da reta, via soma de y²),
+ *      então uma janela ruidosa não vota. A decisão por amostra é a direção em
+ *      que pelo menos duas janelas concordam; se todas estão
+ *      estáveis, ESTÁVEL; senão, mantém a decisão anterior.
+ *
+ *      Só C padrão: também roda no PC (tendencia_replay.c).
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#ifndef TENDENCIA_JANELAS_H
+#define TENDENCIA_JANELAS_H
+
+#include <stdint.h>
+#include "tarefa3_tendencia.h"   // tendencia_t
+
+#define TEND_JANELAS 3
+#define TEND_CURTA 10            // Amostras (1 por segundo)
+#define TEND_MEDIA 30
+#define TEND_LONGA 60
+#define TEND_HISTORICO 64        // >= maior janela, potência de 2
+
+#define TEND_LIMIAR_ENTRA 2.0f   // m°C por amostra (0,12 °C/min a 1 Hz)
+#define TEND_LIMIAR_SAI 1.0f
+#define TEND_Z_ENTRA 3.0f        // Limiares também em erros padrão da inclinação
+#define TEND_Z_SAI 1.5f
+
+typedef struct {
+    uint16_t tamanho;
+    uint16_t n;                  // Amostras na janela (até `tamanho`)
+    int32_t soma;                // Soma das amostras (m°C)
+    int64_t soma_xy;             // Soma de x·y, x = 0 na amostra mais antiga
+    int64_t soma_quad;           // Soma de y²
+    int64_t ema_q16;             // EMA em m°C, ponto fixo Q16
+    int32_t alfa_q16;
+    float inclinacao;            // m°C por amostra
+    tendencia_t estado;
+} tend_janela_t;
+
+typedef struct tend_detector_t {
+    int32_t historico[TEND_HISTORICO];
+    uint32_t total;              // Amostras recebidas
+    tend_janela_t janela[TEND_JANELAS];
+    tendencia_t decisao;
+} tend_detector_t;
+
+void tend_inicia(tend_detector_t *d);
+
+/**
+ * @brief Acrescenta uma amostra (°C) e devolve a decisão de tendência. O(1).
+ */
+tendencia_t tend_adiciona(tend_detector_t *d, float temperatura);
+
+float tend_media(const tend_detector_t *d, int janela);        // °C
+float tend_ema(const tend_detector_t *d, int janela);          // °C
+float tend_inclinacao(const tend_detector_t *d, int janela);   // °C por amostra
+
+#endif  // TENDENCIA_JANELAS_H
@@ -0,0 +1,218 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: tendencia_replay.c
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Ferramenta de PC (não entra no firmware) que reproduz
+ *      uma sequência de temperaturas (1 amostra por segundo)
+ *      em três detectores de tendência e compara o resultado:
+ *        - consecutivo: amostra contra a anterior, ±0,01 °C
+ *          (tarefa3 antiga);
+ *        - blocos: média de 50 amostras contra o bloco anterior,
+ *          ±0,05 °C, decisão mantida até o próximo bloco
+ *          (tarefa5 antiga);
+ *        - janelas: tendencia_janelas.c (atual).
+ *
+ *      Sem arquivo, gera um perfil sintético com trocas de
+ *      tendência conhecidas (estável, subida, estável, descida,
+ *      estável) mais ruído gaussiano e mede, para cada troca, a
+ *      latência até o detector acertar a nova tendência, além
+ *      das trocas de decisão espúrias.
+ *
+ *      Com arquivo, aceita a captura da USB CDC da placa (linhas
+ *      "Temperatura: 23.45 °C ...") ou um número por linha; sem
+ *      referência, mostra as trocas de cada detector e quanto
+ *      os detectores antigos demoram para chegar à mesma
+ *      tendência que o atual.
+ *
+ *      Uso:
+ *          gcc -I. tendencia_replay.c tendencia_janelas.c -lm -o tendencia_replay
+ *          ./tendencia_replay [ruido_C]          (perfil sintético, ruído padrão 0,02 °C)
+ *          ./tendencia_replay -f captura.txt
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "tendencia_janelas.h"
+
+#define MAX_AMOSTRAS 100000
+#define DETECTORES 3
+
+static const char *nomes[DETECTORES] = { "consecutivo", "blocos", "janelas" };
+
+const char* tendencia_para_texto(tendencia_t t) {
+    switch (t) {
+        case TENDENCIA_SUBINDO:  return "SUBINDO";
+        case TENDENCIA_CAINDO:   return "CAINDO";
+        default:                 return "ESTAVEL";
+    }
+}
+
+// --- Detectores antigos, como estavam em tarefa3 e tarefa5 ---
+
+static tendencia_t consecutivo(float atual, float *anterior, int i) {
+    float delta = atual - *anterior;
+    *anterior = atual;
+    if (i == 0) return TENDENCIA_ESTAVEL;
+    if (delta > 0.01f) return TENDENCIA_SUBINDO;
+    if (delta < -0.01f) return TENDENCIA_CAINDO;
+    return TENDENCIA_ESTAVEL;
+}
+
+typedef struct {
+    float soma;
+    int indice;
+    float media_anterior;
+    tendencia_t estado;
+} blocos_t;
+
+static tendencia_t blocos(blocos_t *b, float nova) {
+    b->soma += nova;
+    if (++b->indice >= 50) {
+        float media_atual = b->soma / 50;
+        if (b->media_anterior != 0.0f) {
+            float delta = media_atual - b->media_anterior;
+            b->estado = delta > 0.05f ? TENDENCIA_SUBINDO
+                      : delta < -0.05f ? TENDENCIA_CAINDO : TENDENCIA_ESTAVEL;
+        }
+        b->media_anterior = media_atual;
+        b->soma = 0;
+        b->indice = 0;
+    }
+    return b->estado;
+}
+
+// --- Reprodução ---
+
+static float amostras[MAX_AMOSTRAS];
+static tendencia_t verdade[MAX_AMOSTRAS];
+static tendencia_t decisao[DETECTORES][MAX_AMOSTRAS];
+
+static void reproduz(int n) {
+    float anterior = 0;
+    blocos_t b = { 0 };
+    tend_detector_t d;
+    tend_inicia(&d);
+    for (int i = 0; i < n; i++) {
+        decisao[0][i] = consecutivo(amostras[i], &anterior, i);
+        decisao[1][i] = blocos(&b, amostras[i]);
+        decisao[2][i] = tend_adiciona(&d, amostras[i]);
+    }
+}
+
+static int conta_trocas(const tendencia_t *v, int n) {
+    int trocas = 0;
+    for (int i = 1; i < n; i++) trocas += (v[i] != v[i - 1]);
+    return trocas;
+}
+
+static double gaussiano(void) {
+    double u1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    double u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * 3.14159265358979 * u2);
+}
+
+// Perfil: trechos de 300 s; rampas de 0,3 °C/min
+static int gera_sintetico(float ruido) {
+    static const struct { tendencia_t t; float inclinacao; } trechos[] = {
+        { TENDENCIA_ESTAVEL, 0 }, { TENDENCIA_SUBINDO, 0.005f }, { TENDENCIA_ESTAVEL, 0 },
+        { TENDENCIA_CAINDO, -0.005f }, { TENDENCIA_ESTAVEL, 0 },
+    };
+    const int duracao = 300;
+    float temp = 25.0f;
+    int n = 0;
+    srand(1);
+    for (size_t k = 0; k < sizeof(trechos) / sizeof(trechos[0]); k++) {
+        for (int s = 0; s < duracao; s++, n++) {
+            temp += trechos[k].inclinacao;
+            amostras[n] = temp + (float)(ruido * gaussiano());
+            verdade[n] = trechos[k].t;
+        }
+    }
+    return n;
+}
+
+static void relatorio_sintetico(int n) {
+    printf("%-12s %10s %10s %10s %10s %8s %8s\n", "detector", "->SUBINDO", "->ESTAVEL",
+           "->CAINDO", "->ESTAVEL", "trocas", "erro");
+    for (int j = 0; j < DETECTORES; j++) {
+        printf("%-12s", nomes[j]);
+        for (int i = 1; i < n; i++) {
+            if (verdade[i] == verdade[i - 1]) continue;
+            int fim = i;
+            while (fim < n && verdade[fim] == verdade[i]) fim++;
+            int k = i;
+            while (k < fim && decisao[j][k] != verdade[i]) k++;
+            if (k < fim) printf(" %8d s", k - i);
+            else printf(" %10s", "nunca");
+        }
+        int erradas = 0;
+        for (int i = 0; i < n; i++) erradas += (decisao[j][i] != verdade[i]);
+        printf(" %8d %7.1f%%\n", conta_trocas(decisao[j], n), 100.0 * erradas / n);
+    }
+    printf("(latência da troca real até o detector acertar; trocas ideais: 4)\n");
+}
+
+static int le_arquivo(const char *caminho) {
+    FILE *f = fopen(caminho, "r");
+    if (!f) {
+        perror(caminho);
+        return -1;
+    }
+    char linha[512];
+    int n = 0;
+    while (n < MAX_AMOSTRAS && fgets(linha, sizeof(linha), f)) {
+        const char *p = strstr(linha, "Temperatura:");
+        char *fim;
+        float v = strtof(p ? p + strlen("Temperatura:") : linha, &fim);
+        if (fim != (p ? p + strlen("Temperatura:") : linha)) amostras[n++] = v;
+    }
+    fclose(f);
+    return n;
+}
+
+static void relatorio_captura(int n) {
+    printf("%d amostras\n", n);
+    for (int j = 0; j < DETECTORES; j++) {
+        printf("%-12s %6d trocas\n", nomes[j], conta_trocas(decisao[j], n));
+    }
+    printf("\nTrocas do detector por janelas (atraso dos antigos até a mesma tendência):\n");
+    for (int i = 1; i < n; i++) {
+        if (decisao[2][i] == decisao[2][i - 1]) continue;
+        printf("  t=%5d s %-8s -> %-8s", i, tendencia_para_texto(decisao[2][i - 1]),
+               tendencia_para_texto(decisao[2][i]));
+        for (int j = 0; j < 2; j++) {
+            int k = i;
+            while (k < n && decisao[j][k] != decisao[2][i]) k++;
+            if (k < n) printf(" | %s %+d s", nomes[j], k - i);
+            else printf(" | %s nunca", nomes[j]);
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char **argv) {
+    int n;
+    if (argc > 2 && strcmp(argv[1], "-f") == 0) {
+        n = le_arquivo(argv[2]);
+        if (n <= 0) {
+            fprintf(stderr, "nenhuma temperatura em %s\n", argv[2]);
+            return 1;
+        }
+        reproduz(n);
+        relatorio_captura(n);
+    } else {
+        float ruido = argc > 1 ? strtof(argv[1], NULL) : 0.02f;
+        n = gera_sintetico(ruido);
+        printf("Perfil sintético: %d s, rampas de 0,3 °C/min, ruído %.3f °C\n\n", n, ruido);
+        reproduz(n);
+        relatorio_sintetico(n);
+    }
+    return 0;
+}
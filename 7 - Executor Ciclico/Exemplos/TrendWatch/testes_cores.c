@@ -1,7 +1,13 @@
+#include <stdio.h>
 #include "LabNeoPixel/neopixel_driver.h"
+#include "LabNeoPixel/neopixel_emu.h"
 #include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
 #include "testes_cores.h"
 #include "LabNeoPixel/efeitos.h"
+#include "estatisticas_adc.h"
+#include "tarefa1_temp.h"
 
 typedef struct {
     uint8_t r, g, b;
@@ -48,3 +54,221 @@ void testar_fileiras_colunas(void) {
 
     sleep_ms(500);
 }
+
+// Ciclos de clk_sys decorridos desde `inicio` (SysTick conta para baixo, 24 bits)
+static inline uint32_t ciclos_desde(uint32_t inicio) {
+    return (inicio - systick_hw->cvr) & 0x00FFFFFF;
+}
+
+/**
+ * @brief Compara o custo de CPU por quadro entre npWrite() e npWriteAsync().
+ *
+ * Conta ciclos de clk_sys com o SysTick: no envio bloqueante o tempo inclui a
+ * transmissão do quadro pela PIO; no envio por DMA, só o empacotamento e o disparo.
+ * Entre os quadros assíncronos espera o fim do anterior (npWait) fora da medição.
+ */
+void benchmark_neopixel(int quadros) {
+    uint64_t ciclos_bloqueante = 0;
+    uint64_t ciclos_dma = 0;
+
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;   // Habilitado, clock do processador
+
+    npSetAll(COR_MEIA, COR_APAGA, COR_MEIA);
+
+    for (int i = 0; i < quadros; i++) {
+        npWait();
+        uint32_t inicio = systick_hw->cvr;
+        npWrite();
+        ciclos_bloqueante += ciclos_desde(inicio);
+        sleep_us(NP_RESET_US);
+    }
+
+    for (int i = 0; i < quadros; i++) {
+        npWait();
+        uint32_t inicio = systick_hw->cvr;
+        npWriteAsync();
+        ciclos_dma += ciclos_desde(inicio);
+    }
+    npWait();
+
+    float mhz = clock_get_hz(clk_sys) / 1e6f;
+    printf("[NEOPIXEL] %d LEDs, %d quadros: bloqueante %lu ciclos (%.1f us) | DMA %lu ciclos (%.1f us) por quadro\n",
+           LED_COUNT, quadros,
+           (unsigned long)(ciclos_bloqueante / quadros), ciclos_bloqueante / quadros / mhz,
+           (unsigned long)(ciclos_dma / quadros), ciclos_dma / quadros / mhz);
+
+    npClear();
+    npWrite();
+}
+
+// Mapeamento antigo (uma matriz serpentina, calculado a cada chamada), só como referência
+static uint indice_calculado(uint x, uint y) {
+    if (x >= NUM_COLUNAS || y >= NUM_LINHAS) return 0;
+    uint linha_fisica = NUM_LINHAS - 1 - y;
+    uint base = linha_fisica * NUM_COLUNAS;
+    return (linha_fisica % 2 == 0) ? base + (NUM_COLUNAS - 1 - x) : base + x;
+}
+
+/**
+ * @brief Mede o custo de atualizar o quadro inteiro com a geometria compilada.
+ *
+ * Compara o preenchimento x,y com o índice calculado a cada LED, com a tabela
+ * np_mapa_xy (fileira a fileira) e o empacotamento + disparo do DMA (npWriteAsync).
+ * Para as matrizes maiores, compile com outra geometria, por exemplo:
+ *   256 LEDs:  NP_PAINEL_LARGURA=16 NP_PAINEL_ALTURA=16
+ *   1024 LEDs: NP_PAINEL_LARGURA=16 NP_PAINEL_ALTURA=16 NP_PAINEIS_X=2 NP_PAINEIS_Y=2
+ */
+void benchmark_geometria(int quadros) {
+    uint64_t ciclos_calculado = 0;
+    uint64_t ciclos_tabela = 0;
+    uint64_t ciclos_envio = 0;
+
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;
+
+    for (int i = 0; i < quadros; i++) {
+        uint8_t cor = (i & 1) ? COR_MEIA : COR_APAGA;
+
+        uint32_t inicio = systick_hw->cvr;
+        for (uint y = 0; y < NUM_LINHAS; y++) {
+            for (uint x = 0; x < NUM_COLUNAS; x++) {
+                npSetLED(indice_calculado(x, y), cor, COR_APAGA, cor);
+            }
+        }
+        ciclos_calculado += ciclos_desde(inicio);
+
+        inicio = systick_hw->cvr;
+        for (uint y = 0; y < NUM_LINHAS; y++) {
+            npSetFileira(y, cor, COR_APAGA, cor);
+        }
+        ciclos_tabela += ciclos_desde(inicio);
+
+        npWait();
+        inicio = systick_hw->cvr;
+        npWriteAsync();
+        ciclos_envio += ciclos_desde(inicio);
+    }
+    npWait();
+
+    float mhz = clock_get_hz(clk_sys) / 1e6f;
+    printf("[GEOMETRIA] %ux%u = %d LEDs: calculado %.1f us | tabela %.1f us | empacota+DMA %.1f us | linha %d us por quadro\n",
+           NUM_COLUNAS, NUM_LINHAS, LED_COUNT,
+           ciclos_calculado / quadros / mhz, ciclos_tabela / quadros / mhz, ciclos_envio / quadros / mhz,
+           LED_COUNT * NP_US_POR_LED + NP_RESET_US);
+
+    npClear();
+    npWrite();
+}
+
+/**
+ * @brief Confere no emulador da PIO o quadro que npWrite() enviaria.
+ *
+ * O quadro tem bits 0 e 1 em todos os canais. Para o clk_sys atual e outros valores
+ * usuais, com o divisor calculado como em ws2818b_program_init(), verifica:
+ * os bits decodificados da forma de onda, as faixas T0H/T1H/TL e o reset, e se a
+ * espera agendada pelo driver no fim do DMA ((FIFO + 1) * NP_US_POR_LED) cobre o
+ * que ainda falta transmitir. Imprime a taxa de quadros obtida.
+ *
+ * @return Número de configurações com falha (0 = tudo ok).
+ */
+int teste_emulador_neopixel(void) {
+    static uint32_t quadro[LED_COUNT];
+    static uint32_t grb[LED_COUNT];
+    const uint32_t clocks_hz[] = { clock_get_hz(clk_sys), 48000000, 125000000, 133000000, 200000000 };
+    int falhas = 0;
+
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        npSetLED(i, (i * 37) & 0xFF, 0xA5, 255 - i);
+    }
+    npSetDither(false);
+    npEmpacota(quadro);
+    npClear();
+    for (uint i = 0; i < LED_COUNT; ++i) {
+        grb[i] = quadro[i] >> 8;   // Bytes G, R, B já corrigidos, como o LED deve recebê-los
+    }
+
+    for (uint k = 0; k < sizeof(clocks_hz) / sizeof(clocks_hz[0]); k++) {
+        ws2818b_emu_config_t cfg;
+        ws2818b_emu_resultado_t r;
+
+        npEmuConfig(&cfg, clocks_hz[k]);
+        int erros = ws2818b_emu_run(&cfg, quadro, LED_COUNT, grb, LED_COUNT, NP_RESET_US,
+                                    NULL, 0, NULL, &r);
+
+        uint32_t restante_ns = r.duracao_ns - r.t_ultimo_push_ns;
+        bool espera_ok = (r.nivel_fifo + 1u) * NP_US_POR_LED * 1000u >= restante_ns;
+
+        printf("[NEOPIXEL EMU] clk_sys %lu Hz, clkdiv %u + %u/256\n",
+               (unsigned long)clocks_hz[k], cfg.clkdiv_int, cfg.clkdiv_frac);
+        ws2818b_emu_imprime(&r);
+        if (!espera_ok) {
+            printf("  espera do driver curta: faltavam %lu us\n", (unsigned long)(restante_ns / 1000));
+        }
+        if (erros || !espera_ok) {
+            falhas++;
+        }
+    }
+
+    printf("[NEOPIXEL EMU] %s\n", falhas ? "FALHOU" : "OK");
+    return falhas;
+}
+
+// Conversão por amostra do código antigo da Tarefa 1, só como referência
+static float celsius_por_amostra(uint16_t raw) {
+    const float conv = 3.3f / (1 << 12);
+    float voltage = raw * conv;
+    return 27.0f - (voltage - 0.706f) / 0.001721f;
+}
+
+/**
+ * @brief Compara o processamento de um bloco de TEMP_METADE códigos do ADC.
+ *
+ * O bloco é sintético (código ~876, 27 °C, com ruído de alguns LSB). A referência
+ * converte cada amostra para °C em float e soma; a nova versão acumula contagem,
+ * soma, soma dos quadrados, min/max e histograma em inteiros e converte só a média.
+ * Imprime as amostras por segundo de cada uma e as médias obtidas.
+ */
+void benchmark_estatisticas(int blocos) {
+    static uint16_t bloco[TEMP_METADE];
+    static estat_adc_t e;
+    uint64_t ciclos_float = 0;
+    uint64_t ciclos_inteiro = 0;
+    float media_float = 0.0f;
+
+    uint32_t semente = 1;
+    for (int i = 0; i < TEMP_METADE; i++) {
+        semente = semente * 1664525u + 1013904223u;
+        bloco[i] = 876 + (int)(semente >> 29) - 4;
+    }
+
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;
+
+    for (int b = 0; b < blocos; b++) {
+        uint32_t inicio = systick_hw->cvr;
+        float soma = 0.0f;
+        for (int i = 0; i < TEMP_METADE; i++) {
+            soma += celsius_por_amostra(bloco[i]);
+        }
+        media_float = soma / TEMP_METADE;
+        ciclos_float += ciclos_desde(inicio);
+
+        inicio = systick_hw->cvr;
+        estat_adc_inicia(&e, 876);
+        estat_adc_acumula(&e, bloco, TEMP_METADE);
+        ciclos_inteiro += ciclos_desde(inicio);
+    }
+
+    float hz = (float)clock_get_hz(clk_sys);
+    float amostras = (float)blocos * TEMP_METADE;
+    printf("[ESTATISTICAS] %d blocos de %d: float %.0f amostras/s (%.2f C) | inteiro %.0f amostras/s (%.2f C, mediana %.2f C, desvio %.3f C)\n",
+           blocos, TEMP_METADE,
+           amostras * hz / ciclos_float, media_float,
+           amostras * hz / ciclos_inteiro, estat_adc_celsius(estat_adc_media(&e)),
+           estat_adc_celsius(estat_adc_percentil(&e, 50)),
+           estat_adc_celsius_delta(estat_adc_desvio(&e)));
+}
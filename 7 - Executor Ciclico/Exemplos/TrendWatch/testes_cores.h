@@ -36,8 +36,24 @@
 
 #define LED_PIN 7
 
+// Mede na inicialização o custo de CPU por quadro da matriz (npWrite x npWriteAsync)
+// e o de atualizar o quadro inteiro com a geometria compilada (np_geometria.h)
+#define BENCHMARK_NEOPIXEL 0
+
+// Roda o quadro de npWrite no emulador da PIO (ws2818b_emu.c) e confere os tempos do
+// WS2812 com o clk_sys atual e com outros valores usuais
+#define TESTE_EMULADOR_NEOPIXEL 0
+
+// Mede amostras/s da média de um bloco do ADC: conversão para °C em float a cada
+// amostra (como era) x estatísticas inteiras sobre os códigos (estatisticas_adc.c)
+#define BENCHMARK_ESTATISTICAS 0
+
 // Funções de teste (opcional)
 void preencher_matriz_com_cores(void);
 void testar_fileiras_colunas(void);
+void benchmark_neopixel(int quadros);
+void benchmark_geometria(int quadros);
+int teste_emulador_neopixel(void);
+void benchmark_estatisticas(int blocos);
 
 #endif
@@ -0,0 +1,94 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: trace.c
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Anéis de registros do rastro de execução e envio em bloco
+ *      pela USB CDC (ver trace.h). Gravar um registro custa
+ *      algumas dezenas de ciclos; o envio só acontece na tarefa
+ *      de descarga.
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/stdio.h"
+#include "hardware/sync.h"
+#include "trace.h"
+
+#if (TRACE_CAPACIDADE & (TRACE_CAPACIDADE - 1)) != 0
+#error "TRACE_CAPACIDADE precisa ser potência de 2"
+#endif
+
+typedef struct {
+    trace_registro_t reg[TRACE_CAPACIDADE];
+    volatile uint32_t escrita;      // Só o núcleo dono escreve
+    volatile uint32_t leitura;      // Só trace_descarrega() escreve
+    volatile uint32_t perdidos;
+} trace_anel_t;
+
+static trace_anel_t aneis[NUM_CORES];
+static uint32_t perdidos_enviados[NUM_CORES];
+
+// Quadro montado para o envio: cabeçalho + registros
+static uint8_t quadro[sizeof(trace_cabecalho_t) + TRACE_POR_QUADRO * sizeof(trace_registro_t)]
+    __attribute__((aligned(4)));
+
+void trace_registra(uint8_t tarefa, trace_evento_t evento) {
+    uint nucleo = get_core_num();
+    trace_anel_t *a = &aneis[nucleo];
+    uint32_t e = a->escrita;
+
+    if (e - a->leitura >= TRACE_CAPACIDADE) {
+        a->perdidos++;
+        return;
+    }
+
+    a->reg[e & (TRACE_CAPACIDADE - 1)] = (trace_registro_t){
+        time_us_32(), tarefa, (uint8_t)evento, (uint8_t)nucleo, (uint8_t)e
+    };
+    __dmb();             // O registro fica visível antes do novo índice
+    a->escrita = e + 1;
+}
+
+uint32_t trace_descarrega(void) {
+    uint32_t enviados = 0;
+
+    for (uint nucleo = 0; nucleo < NUM_CORES; nucleo++) {
+        trace_anel_t *a = &aneis[nucleo];
+
+        while (a->leitura != a->escrita) {
+            uint32_t l = a->leitura;
+            uint32_t n = a->escrita - l;
+            if (n > TRACE_POR_QUADRO) {
+                n = TRACE_POR_QUADRO;
+            }
+            __dmb();
+
+            trace_registro_t *regs = (trace_registro_t *)(quadro + sizeof(trace_cabecalho_t));
+            for (uint32_t i = 0; i < n; i++) {
+                regs[i] = a->reg[(l + i) & (TRACE_CAPACIDADE - 1)];
+            }
+            __dmb();
+            a->leitura = l + n;   // Libera o espaço antes do envio, que é o trecho lento
+
+            uint32_t perdidos = a->perdidos;
+            trace_cabecalho_t cab = {
+                TRACE_MAGICO, (uint16_t)n,
+                (uint16_t)(perdidos - perdidos_enviados[nucleo]), trace_soma(regs, n)
+            };
+            perdidos_enviados[nucleo] = perdidos;
+            memcpy(quadro, &cab, sizeof(cab));
+
+            // Binário puro: sem quebra de linha nem tradução de \n para \r\n
+            stdio_put_string((const char *)quadro,
+                             sizeof(trace_cabecalho_t) + n * sizeof(trace_registro_t), false, false);
+            enviados += n;
+        }
+    }
+
+    return enviados;
+}
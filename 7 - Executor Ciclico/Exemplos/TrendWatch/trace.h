@@ -0,0 +1,84 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: trace.h
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Rastro de execução das tarefas com custo mínimo. Cada
+ *      entrada e saída de tarefa grava um registro binário de
+ *      8 bytes (instante, tarefa, evento, núcleo) em um anel na
+ *      RAM, sem printf e sem travas: há um anel por núcleo, com
+ *      um único produtor (o núcleo) e um único consumidor
+ *      (trace_descarrega).
+ *
+ *      trace_descarrega(), chamada como tarefa de fundo, envia
+ *      os registros acumulados em bloco pela USB CDC, em quadros
+ *      binários com cabeçalho (TRACE_MAGICO, quantidade, perdas
+ *      e soma de conferência). O texto dos printf pode vir
+ *      misturado: o decodificador de PC (trace_decodificador.c)
+ *      procura os quadros pelo número mágico.
+ *
+ *      Os tipos abaixo são só C padrão e servem também ao
+ *      decodificador.
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+#define TRACE_CAPACIDADE 256          // Registros por núcleo (potência de 2)
+#define TRACE_POR_QUADRO 64           // Registros por quadro enviado
+#define TRACE_MAGICO 0x31435254u      // "TRC1" em little-endian
+
+typedef enum {
+    TRACE_ENTRADA = 0,
+    TRACE_SAIDA = 1
+} trace_evento_t;
+
+typedef struct {
+    uint32_t t_us;          // time_us_32()
+    uint8_t tarefa;         // Índice da tarefa na agenda
+    uint8_t evento;         // trace_evento_t
+    uint8_t nucleo;
+    uint8_t seq;            // 8 bits baixos do contador do anel (detecta buracos)
+} trace_registro_t;
+
+typedef struct {
+    uint32_t magico;
+    uint16_t n;             // Registros que seguem o cabeçalho
+    uint16_t perdidos;      // Registros descartados com o anel cheio desde o quadro anterior
+    uint32_t soma;          // Soma das palavras de 32 bits dos registros
+} trace_cabecalho_t;
+
+_Static_assert(sizeof(trace_registro_t) == 8, "registro do trace deve ter 8 bytes");
+_Static_assert(sizeof(trace_cabecalho_t) == 12, "cabeçalho do trace deve ter 12 bytes");
+
+/**
+ * @brief Grava um evento da tarefa no anel do núcleo atual (descarta se cheio).
+ */
+void trace_registra(uint8_t tarefa, trace_evento_t evento);
+
+/**
+ * @brief Envia pela USB os registros pendentes, em quadros de até TRACE_POR_QUADRO.
+ *
+ * @return Registros enviados.
+ */
+uint32_t trace_descarrega(void);
+
+/**
+ * @brief Soma de conferência de `n` registros (usada no envio e no decodificador).
+ */
+static inline uint32_t trace_soma(const trace_registro_t *r, uint32_t n) {
+    const uint32_t *p = (const uint32_t *)r;
+    uint32_t soma = 0;
+    for (uint32_t i = 0; i < 2 * n; i++) {
+        soma += p[i];
+    }
+    return soma;
+}
+
+#endif  // TRACE_H
@@ -0,0 +1,234 @@
+/**
+ * ------------------------------------------------------------
+ *  Arquivo: trace_decodificador.c
+ *  Projeto: TrendWatch
+ * ------------------------------------------------------------
+ *  Descrição:
+ *      Ferramenta de PC (não entra no firmware) que lê uma
+ *      captura da USB CDC da placa, com os printf misturados,
+ *      encontra os quadros do rastro (trace.h) e imprime, por
+ *      tarefa de agenda.h:
+ *        - execuções, tempo máximo (WCET observado), médio e
+ *          mínimo;
+ *        - histograma do tempo de execução;
+ *        - histograma do jitter de início (intervalo entre
+ *          inícios consecutivos menos o período da tarefa).
+ *      Opcionalmente grava a linha do tempo no formato JSON do
+ *      Chrome Trace (abrir em chrome://tracing ou Perfetto).
+ *
+ *      Uso:
+ *          gcc -I. trace_decodificador.c -o trace_decodificador
+ *          cat /dev/ttyACM0 > captura.bin      (Ctrl+C para parar)
+ *          ./trace_decodificador captura.bin [linha_do_tempo.json]
+ *
+ *  Data: 12/05/2025
+ * ------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trace.h"
+#include "agenda.h"
+
+#define NOME_E_PERIODO(nome, funcao, periodo, offset, orcamento) { nome, periodo, orcamento },
+
+static const struct {
+    const char *nome;
+    uint32_t periodo_ms;
+    uint32_t orcamento_us;
+} agenda[] = { AGENDA_TAREFAS(NOME_E_PERIODO) };
+
+#define N_TAREFAS (sizeof(agenda) / sizeof(agenda[0]))
+#define N_NUCLEOS 2
+#define N_FAIXAS 24            // Histogramas em potências de 2 de microssegundos
+
+typedef struct {
+    uint32_t execucoes;
+    uint64_t soma_us;
+    uint64_t max_us, min_us;
+    uint32_t hist_exec[N_FAIXAS];
+    uint32_t hist_jitter[N_FAIXAS];
+    int64_t jitter_max_us;
+    uint64_t ultimo_inicio;
+    int tem_inicio;
+    uint64_t aberta_em[N_NUCLEOS];   // Entrada sem saída ainda (0 = nenhuma)
+} estat_tarefa_t;
+
+static estat_tarefa_t estat[N_TAREFAS];
+
+// Relógio de 64 bits por núcleo a partir do time_us_32() (volta a cada ~71 min)
+static uint64_t base_us[N_NUCLEOS];
+static uint32_t ultimo_t[N_NUCLEOS];
+static int primeiro[N_NUCLEOS] = { 1, 1 };
+
+static uint64_t relogio(uint8_t nucleo, uint32_t t) {
+    if (!primeiro[nucleo] && t < ultimo_t[nucleo] && ultimo_t[nucleo] - t > 0x80000000u) {
+        base_us[nucleo] += 0x100000000ull;
+    }
+    primeiro[nucleo] = 0;
+    ultimo_t[nucleo] = t;
+    return base_us[nucleo] + t;
+}
+
+static int faixa(uint64_t us) {
+    int f = 0;
+    while (us > 1 && f < N_FAIXAS - 1) {
+        us >>= 1;
+        f++;
+    }
+    return f;
+}
+
+static void histograma(const char *titulo, const uint32_t *h) {
+    uint32_t maior = 0;
+    for (int f = 0; f < N_FAIXAS; f++) {
+        if (h[f] > maior) maior = h[f];
+    }
+    if (maior == 0) {
+        return;
+    }
+    printf("    %s\n", titulo);
+    for (int f = 0; f < N_FAIXAS; f++) {
+        if (h[f] == 0) {
+            continue;
+        }
+        int barra = (int)(40ull * h[f] / maior);
+        printf("      < %8llu us %7u ", 1ull << (f + 1), h[f]);
+        for (int i = 0; i < (barra ? barra : 1); i++) putchar('#');
+        putchar('\n');
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "uso: %s captura.bin [linha_do_tempo.json]\n", argv[0]);
+        return 1;
+    }
+
+    FILE *f = fopen(argv[1], "rb");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    long tamanho = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *dados = malloc(tamanho > 0 ? tamanho : 1);
+    if (!dados || fread(dados, 1, tamanho, f) != (size_t)tamanho) {
+        fprintf(stderr, "erro lendo %s\n", argv[1]);
+        return 1;
+    }
+    fclose(f);
+
+    FILE *json = NULL;
+    if (argc > 2) {
+        json = fopen(argv[2], "w");
+        if (!json) {
+            perror(argv[2]);
+            return 1;
+        }
+        fprintf(json, "{\"traceEvents\":[\n");
+    }
+    int primeiro_evento = 1;
+
+    uint32_t quadros = 0, registros = 0, perdidos = 0, invalidos = 0, buracos = 0;
+    uint8_t seq_esperada[N_NUCLEOS];
+    int tem_seq[N_NUCLEOS] = { 0, 0 };
+
+    for (long i = 0; i + (long)sizeof(trace_cabecalho_t) <= tamanho; ) {
+        trace_cabecalho_t cab;
+        memcpy(&cab, dados + i, sizeof(cab));
+        long fim = i + sizeof(cab) + (long)cab.n * sizeof(trace_registro_t);
+
+        if (cab.magico != TRACE_MAGICO || cab.n == 0 || cab.n > TRACE_POR_QUADRO || fim > tamanho) {
+            i++;
+            continue;
+        }
+        trace_registro_t regs[TRACE_POR_QUADRO];
+        memcpy(regs, dados + i + sizeof(cab), cab.n * sizeof(trace_registro_t));
+        if (trace_soma(regs, cab.n) != cab.soma) {
+            invalidos++;
+            i++;
+            continue;
+        }
+
+        quadros++;
+        perdidos += cab.perdidos;
+        i = fim;
+
+        for (uint32_t k = 0; k < cab.n; k++) {
+            const trace_registro_t *r = &regs[k];
+            if (r->nucleo >= N_NUCLEOS) {
+                continue;
+            }
+            registros++;
+
+            if (tem_seq[r->nucleo] && r->seq != seq_esperada[r->nucleo]) {
+                buracos++;
+            }
+            tem_seq[r->nucleo] = 1;
+            seq_esperada[r->nucleo] = r->seq + 1;
+
+            if (r->tarefa >= N_TAREFAS) {
+                continue;   // Captura de outra versão da agenda
+            }
+
+            uint64_t t = relogio(r->nucleo, r->t_us);
+            estat_tarefa_t *e = &estat[r->tarefa];
+
+            if (r->evento == TRACE_ENTRADA) {
+                if (e->tem_inicio) {
+                    int64_t jitter = (int64_t)(t - e->ultimo_inicio) - agenda[r->tarefa].periodo_ms * 1000ll;
+                    int64_t abs_jitter = jitter < 0 ? -jitter : jitter;
+                    e->hist_jitter[faixa(abs_jitter)]++;
+                    if (abs_jitter > e->jitter_max_us) e->jitter_max_us = abs_jitter;
+                }
+                e->tem_inicio = 1;
+                e->ultimo_inicio = t;
+                e->aberta_em[r->nucleo] = t ? t : 1;
+            } else if (e->aberta_em[r->nucleo]) {
+                uint64_t inicio = e->aberta_em[r->nucleo];
+                uint64_t dur = t - inicio;
+                e->aberta_em[r->nucleo] = 0;
+
+                e->execucoes++;
+                e->soma_us += dur;
+                if (dur > e->max_us) e->max_us = dur;
+                if (e->execucoes == 1 || dur < e->min_us) e->min_us = dur;
+                e->hist_exec[faixa(dur)]++;
+
+                if (json) {
+                    fprintf(json, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%llu,\"pid\":1,\"tid\":%u}",
+                            primeiro_evento ? "" : ",\n", agenda[r->tarefa].nome,
+                            (unsigned long long)inicio, (unsigned long long)dur, r->nucleo);
+                    primeiro_evento = 0;
+                }
+            }
+        }
+    }
+
+    if (json) {
+        fprintf(json, "\n],\"displayTimeUnit\":\"ms\"}\n");
+        fclose(json);
+    }
+
+    printf("Quadros: %u | registros: %u | perdidos no anel: %u | buracos na sequência: %u | quadros inválidos: %u\n\n",
+           quadros, registros, perdidos, buracos, invalidos);
+
+    for (uint32_t i = 0; i < N_TAREFAS; i++) {
+        const estat_tarefa_t *e = &estat[i];
+        if (e->execucoes == 0) {
+            continue;
+        }
+        printf("%-12s %6u exec | WCET %6llu us (orç. %u) | média %8.1f us | mín %6llu us | jitter máx %lld us\n",
+               agenda[i].nome, e->execucoes, (unsigned long long)e->max_us, agenda[i].orcamento_us,
+               (double)e->soma_us / e->execucoes, (unsigned long long)e->min_us,
+               (long long)e->jitter_max_us);
+        histograma("tempo de execução", e->hist_exec);
+        histograma("jitter de início (|intervalo - período|)", e->hist_jitter);
+    }
+
+    free(dados);
+    return 0;
+}